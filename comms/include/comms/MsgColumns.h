@@ -0,0 +1,541 @@
+//
+// Copyright 2017 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// Contains definition of comms::MsgColumns class.
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+#include <tuple>
+#include <iterator>
+#include <type_traits>
+
+#include "comms/Assert.h"
+#include "comms/ErrorStatus.h"
+#include "comms/util/Tuple.h"
+#include "comms/field/Optional.h"
+
+namespace comms
+{
+
+namespace details
+{
+
+template <bool TOptional>
+struct MsgColumnValueHelper;
+
+template <>
+struct MsgColumnValueHelper<false>
+{
+    template <typename TField>
+    using Type = typename TField::ValueType;
+
+    template <typename TField>
+    static const Type<TField>& value(const TField& field)
+    {
+        return field.value();
+    }
+
+    template <typename TField>
+    static constexpr bool exists(const TField&)
+    {
+        return true;
+    }
+};
+
+template <>
+struct MsgColumnValueHelper<true>
+{
+    template <typename TField>
+    using Type = typename TField::Field::ValueType;
+
+    template <typename TField>
+    static const Type<TField>& value(const TField& field)
+    {
+        return field.field().value();
+    }
+
+    template <typename TField>
+    static bool exists(const TField& field)
+    {
+        return field.doesExist();
+    }
+};
+
+template <typename TAllFields>
+struct MsgColumnsTupleHelper;
+
+}  // namespace details
+
+/// @brief Single column of the comms::MsgColumns storage.
+/// @details Contains values of the same field of all the decoded messages
+///     stored in contiguous memory area. If the field is a variant of
+///     comms::field::Optional, the values of the wrapped field are stored
+///     and the existence of the field is recorded in separate validity bitmap,
+///     one bit per row. The missing optional fields occupy the row as well
+///     (with default value of the wrapped field) to keep all the columns aligned.
+/// @tparam TField Type of the message field.
+/// @headerfile comms/MsgColumns.h
+template <typename TField>
+class MsgColumn
+{
+    using Helper = details::MsgColumnValueHelper<comms::field::isOptional<TField>()>;
+public:
+    /// @brief Type of the message field.
+    using Field = TField;
+
+    /// @brief Type of the stored value.
+    using ValueType = typename Helper::template Type<TField>;
+
+    /// @brief Type of the storage of the values.
+    using ValuesStorage = std::vector<ValueType>;
+
+    /// @brief Type of the single word of the validity bitmap.
+    using BitmapWord = std::uint64_t;
+
+    /// @brief Type of the validity bitmap storage.
+    using ValidityStorage = std::vector<BitmapWord>;
+
+    /// @brief Number of rows recorded by single word of the validity bitmap.
+    static const std::size_t BitsPerWord = sizeof(BitmapWord) * 8U;
+
+    /// @brief Compile time inquiry whether the column maintains validity bitmap.
+    /// @return true if and only if the field is a variant of comms::field::Optional.
+    static constexpr bool hasValidity()
+    {
+        return comms::field::isOptional<TField>();
+    }
+
+    /// @brief Get access to the stored values.
+    const ValuesStorage& values() const
+    {
+        return values_;
+    }
+
+    /// @brief Get access to the validity bitmap.
+    /// @details Bit @b N of the word @b N / @ref BitsPerWord is set if the
+    ///     field in row @b N exists. The bitmap is always empty if hasValidity()
+    ///     returns false.
+    const ValidityStorage& validity() const
+    {
+        return validity_;
+    }
+
+    /// @brief Get number of stored rows.
+    std::size_t size() const
+    {
+        return values_.size();
+    }
+
+    /// @brief Check whether the field exists in the specified row.
+    /// @details Always returns true for the non-optional fields.
+    /// @pre @b row is less than size().
+    bool isValid(std::size_t row) const
+    {
+        GASSERT(row < size());
+        return isValidInternal(row, ValidityTag());
+    }
+
+    /// @brief Access the value in the specified row.
+    /// @pre @b row is less than size().
+    const ValueType& operator[](std::size_t row) const
+    {
+        GASSERT(row < size());
+        return values_[row];
+    }
+
+    /// @brief Reserve storage for the specified number of rows.
+    void reserve(std::size_t rows)
+    {
+        values_.reserve(rows);
+        reserveInternal(rows, ValidityTag());
+    }
+
+    /// @brief Remove all the rows.
+    void clear()
+    {
+        values_.clear();
+        validity_.clear();
+    }
+
+    /// @brief Append value of the provided field as a new row.
+    void append(const Field& field)
+    {
+        appendInternal(field, ValidityTag());
+        values_.push_back(Helper::value(field));
+    }
+
+    /// @brief Remove the last row.
+    /// @pre The column is not empty.
+    void popBack()
+    {
+        GASSERT(!values_.empty());
+        values_.pop_back();
+        popBackInternal(ValidityTag());
+    }
+
+private:
+    using ValidityTag = std::integral_constant<bool, comms::field::isOptional<TField>()>;
+
+    bool isValidInternal(std::size_t row, std::true_type) const
+    {
+        auto mask = static_cast<BitmapWord>(1U) << (row % BitsPerWord);
+        return (validity_[row / BitsPerWord] & mask) != 0U;
+    }
+
+    static bool isValidInternal(std::size_t, std::false_type)
+    {
+        return true;
+    }
+
+    void reserveInternal(std::size_t rows, std::true_type)
+    {
+        validity_.reserve((rows + BitsPerWord - 1) / BitsPerWord);
+    }
+
+    static void reserveInternal(std::size_t, std::false_type)
+    {
+    }
+
+    void appendInternal(const Field& field, std::true_type)
+    {
+        auto row = values_.size();
+        if ((row % BitsPerWord) == 0U) {
+            validity_.push_back(0U);
+        }
+
+        if (Helper::exists(field)) {
+            validity_.back() |= static_cast<BitmapWord>(1U) << (row % BitsPerWord);
+        }
+    }
+
+    static void appendInternal(const Field&, std::false_type)
+    {
+    }
+
+    void popBackInternal(std::true_type)
+    {
+        auto row = values_.size();
+        if ((row % BitsPerWord) == 0U) {
+            validity_.pop_back();
+            return;
+        }
+
+        validity_.back() &= ~(static_cast<BitmapWord>(1U) << (row % BitsPerWord));
+    }
+
+    static void popBackInternal(std::false_type)
+    {
+    }
+
+    ValuesStorage values_;
+    ValidityStorage validity_;
+};
+
+template <typename TMsg>
+class MsgColumns;
+
+/// @brief Object that is passed through the protocol stack instead of the
+///     smart pointer to message when decoding into comms::MsgColumns.
+/// @details Created by comms::MsgColumns::read(). The protocol layers treat
+///     it the same way as they treat smart pointer to the message object:
+///     comms::protocol::MsgIdLayer verifies the message ID,
+///     comms::protocol::MsgDataLayer decodes the message payload and appends
+///     new row, while the checksum layers call reset() to drop the appended
+///     row when the checksum verification fails.
+/// @tparam TMsg Type of the decoded message.
+/// @headerfile comms/MsgColumns.h
+template <typename TMsg>
+class MsgColumnsInserter
+{
+public:
+    /// @brief Type of the decoded message.
+    using Message = TMsg;
+
+    /// @brief Constructor
+    explicit MsgColumnsInserter(MsgColumns<TMsg>& columns)
+      : columns_(columns)
+    {
+        columns_.resetScratch();
+    }
+
+    /// @brief Get access to the message object used to decode the payload.
+    /// @details The same object is reused for all the decoded frames.
+    Message& msg()
+    {
+        return columns_.scratch_;
+    }
+
+    /// @brief Append the decoded fields as a new row.
+    void insert()
+    {
+        GASSERT(!inserted_);
+        columns_.appendRow(columns_.scratch_.fields());
+        inserted_ = true;
+    }
+
+    /// @brief Drop the appended row (if such exists).
+    void reset()
+    {
+        if (inserted_) {
+            columns_.popRow();
+            inserted_ = false;
+        }
+    }
+
+    /// @brief Check whether new row has been appended.
+    explicit operator bool() const
+    {
+        return inserted_;
+    }
+
+private:
+    MsgColumns<TMsg>& columns_;
+    bool inserted_ = false;
+};
+
+/// @brief Structure of arrays storage for bulk decoding of the messages of
+///     the same type.
+/// @details Decodes the stream of frames containing the message of the
+///     same type directly into one contiguous column (comms::MsgColumn) per
+///     message field without creating separate message object for every
+///     decoded frame. The provided protocol stack must contain
+///     comms::protocol::MsgIdLayer and comms::protocol::MsgDataLayer, the
+///     frames of all the other messages are skipped.
+///     Single instance of the message object is used to decode all the payloads,
+///     which allows custom @b doRead() (for example updating the mode of the
+///     optional fields) to be properly performed. The @b doRead() member
+///     function is invoked directly without virtual function call. The fields
+///     of this object are restored to their state right after construction
+///     before every decoded frame.
+/// @tparam TMsg Type of the message, expected to extend comms::MessageBase
+///     and use comms::option::FieldsImpl and comms::option::StaticNumIdImpl options.
+/// @headerfile comms/MsgColumns.h
+template <typename TMsg>
+class MsgColumns
+{
+    friend class MsgColumnsInserter<TMsg>;
+
+public:
+    /// @brief Type of the decoded message.
+    using Message = TMsg;
+
+    /// @brief All the message fields bundled in std::tuple.
+    using AllFields = typename Message::AllFields;
+
+    /// @brief All the columns bundled in std::tuple, one comms::MsgColumn per field.
+    using Columns = typename details::MsgColumnsTupleHelper<AllFields>::Type;
+
+    /// @brief Type of the object passed through the protocol stack.
+    using Inserter = MsgColumnsInserter<Message>;
+
+    /// @brief Type of the column for the field with specified index.
+    template <std::size_t TIdx>
+    using ColumnType = typename std::tuple_element<TIdx, Columns>::type;
+
+    /// @brief Get number of the decoded rows.
+    std::size_t size() const
+    {
+        return rows_;
+    }
+
+    /// @brief Check whether there are no decoded rows.
+    bool empty() const
+    {
+        return rows_ == 0U;
+    }
+
+    /// @brief Reserve storage for the specified number of rows in every column.
+    void reserve(std::size_t rows)
+    {
+        util::tupleForEach(columns_, ColumnReserver(rows));
+    }
+
+    /// @brief Remove all the rows.
+    void clear()
+    {
+        util::tupleForEach(columns_, ColumnClearer());
+        rows_ = 0U;
+    }
+
+    /// @brief Get access to all the columns.
+    const Columns& columns() const
+    {
+        return columns_;
+    }
+
+    /// @brief Get access to the column of the field with specified index.
+    template <std::size_t TIdx>
+    const ColumnType<TIdx>& column() const
+    {
+        return std::get<TIdx>(columns_);
+    }
+
+    /// @brief Append values of the provided fields as a new row.
+    void appendRow(const AllFields& fields)
+    {
+        util::tupleForEachWithTemplateParamIdx(columns_, RowAppender(fields));
+        ++rows_;
+    }
+
+    /// @brief Remove the last row.
+    /// @pre There is at least one row.
+    void popRow()
+    {
+        GASSERT(!empty());
+        util::tupleForEach(columns_, ColumnRowPopper());
+        --rows_;
+    }
+
+    /// @brief Decode single frame and append its contents as a new row.
+    /// @details Invokes @b read() member function of the provided protocol
+    ///     stack with @ref Inserter object instead of smart pointer to the message.
+    /// @param[in] stack Protocol stack.
+    /// @param[in, out] iter Random access iterator used for reading.
+    /// @param[in] size Number of bytes available for reading.
+    /// @param[out] missingSize Same as the one passed to @b read() of the
+    ///     protocol stack.
+    /// @return Status of the read operation. comms::ErrorStatus::InvalidMsgId
+    ///     is returned when the frame contains other message.
+    template <typename TStack, typename TIter>
+    ErrorStatus read(
+        TStack& stack,
+        TIter& iter,
+        std::size_t size,
+        std::size_t* missingSize = nullptr)
+    {
+        Inserter inserter(*this);
+        auto es = stack.read(inserter, iter, size, missingSize);
+        if ((es != ErrorStatus::Success) && inserter) {
+            inserter.reset();
+        }
+        return es;
+    }
+
+    /// @brief Decode all the frames in the provided buffer.
+    /// @details The frames of other messages are skipped. In case of protocol
+    ///     error a single byte is dropped and the decoding is retried from
+    ///     the next position.
+    /// @param[in] stack Protocol stack.
+    /// @param[in, out] iter Random access iterator used for reading, on return
+    ///     points to the first byte of the incomplete frame (if such exists).
+    /// @param[in] size Number of bytes available for reading.
+    /// @return Number of the appended rows.
+    template <typename TStack, typename TIter>
+    std::size_t readAll(TStack& stack, TIter& iter, std::size_t size)
+    {
+        using IterType = typename std::decay<decltype(iter)>::type;
+        static_assert(std::is_same<typename std::iterator_traits<IterType>::iterator_category, std::random_access_iterator_tag>::value,
+            "Iterator used for reading is expected to be random access one");
+
+        auto origRows = rows_;
+        while (0U < size) {
+            auto fromIter = iter;
+            auto es = read(stack, iter, size);
+            if (es == ErrorStatus::NotEnoughData) {
+                iter = fromIter;
+                break;
+            }
+
+            auto consumed = static_cast<std::size_t>(std::distance(fromIter, iter));
+            if ((es == ErrorStatus::ProtocolError) || (consumed == 0U) || (size < consumed)) {
+                iter = fromIter;
+                ++iter;
+                consumed = 1U;
+            }
+
+            size -= consumed;
+        }
+        return rows_ - origRows;
+    }
+
+private:
+    class ColumnReserver
+    {
+    public:
+        explicit ColumnReserver(std::size_t rows) : rows_(rows) {}
+
+        template <typename TColumn>
+        void operator()(TColumn& column) const
+        {
+            column.reserve(rows_);
+        }
+
+    private:
+        std::size_t rows_;
+    };
+
+    struct ColumnClearer
+    {
+        template <typename TColumn>
+        void operator()(TColumn& column) const
+        {
+            column.clear();
+        }
+    };
+
+    struct ColumnRowPopper
+    {
+        template <typename TColumn>
+        void operator()(TColumn& column) const
+        {
+            column.popBack();
+        }
+    };
+
+    class RowAppender
+    {
+    public:
+        explicit RowAppender(const AllFields& fields) : fields_(fields) {}
+
+        template <std::size_t TIdx, typename TColumn>
+        void operator()(TColumn& column) const
+        {
+            column.append(std::get<TIdx>(fields_));
+        }
+
+    private:
+        const AllFields& fields_;
+    };
+
+    void resetScratch()
+    {
+        scratch_.fields() = initialFields_;
+    }
+
+    Columns columns_;
+    std::size_t rows_ = 0U;
+    Message scratch_;
+    const AllFields initialFields_ = scratch_.fields();
+};
+
+namespace details
+{
+
+template <typename... TFields>
+struct MsgColumnsTupleHelper<std::tuple<TFields...> >
+{
+    using Type = std::tuple<MsgColumn<TFields>...>;
+};
+
+}  // namespace details
+
+}  // namespace comms
+
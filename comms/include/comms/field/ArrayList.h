@@ -23,6 +23,7 @@
 #include "comms/ErrorStatus.h"
 #include "comms/options.h"
 #include "comms/util/StaticVector.h"
+#include "comms/util/SmallVector.h"
 #include "basic/ArrayList.h"
 #include "details/AdaptBasicField.h"
 #include "details/OptionsParser.h"
@@ -37,25 +38,32 @@ namespace field
 namespace details
 {
 
-template <bool THasCustomStorageType, bool THasFixedStorage>
+template <bool THasCustomStorageType, bool THasFixedStorage, bool THasSmallBufferStorage>
 struct ArrayListStorageType;
 
-template <bool THasFixedStorage>
-struct ArrayListStorageType<true, THasFixedStorage>
+template <bool THasFixedStorage, bool THasSmallBufferStorage>
+struct ArrayListStorageType<true, THasFixedStorage, THasSmallBufferStorage>
 {
     template <typename TElement, typename TOptions>
     using Type = typename TOptions::CustomStorageType;
 };
 
-template <>
-struct ArrayListStorageType<false, true>
+template <bool THasSmallBufferStorage>
+struct ArrayListStorageType<false, true, THasSmallBufferStorage>
 {
     template <typename TElement, typename TOptions>
     using Type = comms::util::StaticVector<TElement, TOptions::FixedSizeStorage>;
 };
 
 template <>
-struct ArrayListStorageType<false, false>
+struct ArrayListStorageType<false, false, true>
+{
+    template <typename TElement, typename TOptions>
+    using Type = comms::util::SmallVector<TElement, TOptions::SmallBufferStorage>;
+};
+
+template <>
+struct ArrayListStorageType<false, false, false>
 {
     template <typename TElement, typename TOptions>
     using Type = std::vector<TElement>;
@@ -65,7 +73,8 @@ template <typename TElement, typename TOptions>
 using ArrayListStorageTypeT =
     typename ArrayListStorageType<
         TOptions::HasCustomStorageType,
-        TOptions::HasFixedSizeStorage
+        TOptions::HasFixedSizeStorage,
+        TOptions::HasSmallBufferStorage
     >::template Type<TElement, TOptions>;
 
 template <typename TFieldBase, typename TElement, typename... TOptions>
@@ -84,7 +93,9 @@ using ArrayListBase =
 /// @details By default uses
 ///     <a href="http://en.cppreference.com/w/cpp/container/vector">std::vector</a>,
 ///     for internal storage, unless comms::option::FixedSizeStorage option is used,
-///     which forces usage of comms::util::StaticVector instead.
+///     which forces usage of comms::util::StaticVector instead, or
+///     comms::option::SmallBufferStorage option is used, which forces usage of
+///     comms::util::SmallVector.
 /// @tparam TFieldBase Base class for this field, expected to be a variant of
 ///     comms::Field.
 /// @tparam TElement Element of the collection, can be either basic integral value
@@ -114,6 +125,7 @@ using ArrayListBase =
 ///     of the field.@n
 ///     Supported options are:
 ///     @li comms::option::FixedSizeStorage
+///     @li comms::option::SmallBufferStorage
 ///     @li comms::option::CustomStorageType
 ///     @li comms::option::SequenceSizeFieldPrefix
 ///     @li comms::option::SequenceSerLengthFieldPrefix
@@ -148,7 +160,9 @@ public:
     /// @details If comms::option::FixedSizeStorage option is NOT used, the
     ///     ValueType is std::vector<TElement>, otherwise it becomes
     ///     comms::util::StaticVector<TElement, TSize>, where TSize is a size
-    ///     provided to comms::option::FixedSizeStorage option.
+    ///     provided to comms::option::FixedSizeStorage option. If
+    ///     comms::option::SmallBufferStorage option is used, the ValueType is
+    ///     comms::util::SmallVector<TElement, TSize>.
     using ValueType = typename Base::ValueType;
 
     /// @brief Default constructor
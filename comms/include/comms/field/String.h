@@ -23,6 +23,7 @@
 #include "comms/ErrorStatus.h"
 #include "comms/options.h"
 #include "comms/util/StaticString.h"
+#include "comms/util/SmallString.h"
 #include "basic/ArrayList.h"
 #include "details/AdaptBasicField.h"
 #include "details/OptionsParser.h"
@@ -37,25 +38,32 @@ namespace field
 namespace details
 {
 
-template <bool THasCustomStorageType, bool THasFixedStorage>
+template <bool THasCustomStorageType, bool THasFixedStorage, bool THasSmallBufferStorage>
 struct StringStorageType;
 
-template <bool THasFixedStorage>
-struct StringStorageType<true, THasFixedStorage>
+template <bool THasFixedStorage, bool THasSmallBufferStorage>
+struct StringStorageType<true, THasFixedStorage, THasSmallBufferStorage>
 {
     template <typename TOptions>
     using Type = typename TOptions::CustomStorageType;
 };
 
-template <>
-struct StringStorageType<false, true>
+template <bool THasSmallBufferStorage>
+struct StringStorageType<false, true, THasSmallBufferStorage>
 {
     template <typename TOptions>
     using Type = comms::util::StaticString<TOptions::FixedSizeStorage>;
 };
 
 template <>
-struct StringStorageType<false, false>
+struct StringStorageType<false, false, true>
+{
+    template <typename TOptions>
+    using Type = comms::util::SmallString<TOptions::SmallBufferStorage>;
+};
+
+template <>
+struct StringStorageType<false, false, false>
 {
     template <typename TOptions>
     using Type = std::string;
@@ -65,7 +73,8 @@ template <typename TOptions>
 using StringStorageTypeT =
     typename StringStorageType<
         TOptions::HasCustomStorageType,
-        TOptions::HasFixedSizeStorage
+        TOptions::HasFixedSizeStorage,
+        TOptions::HasSmallBufferStorage
     >::template Type<TOptions>;
 
 template <typename TFieldBase, typename... TOptions>
@@ -81,13 +90,16 @@ using StringBase =
 /// @details By default uses
 ///     <a href="http://en.cppreference.com/w/cpp/string/basic_string">std::string</a>,
 ///     for internal storage, unless comms::option::FixedSizeStorage option is used,
-///     which forces usage of comms::util::StaticString instead.
+///     which forces usage of comms::util::StaticString instead, or
+///     comms::option::SmallBufferStorage option is used, which forces usage of
+///     comms::util::SmallString.
 /// @tparam TFieldBase Base class for this field, expected to be a variant of
 ///     comms::Field.
 /// @tparam TOptions Zero or more options that modify/refine default behaviour
 ///     of the field.@n
 ///     Supported options are:
 ///     @li comms::option::FixedSizeStorage
+///     @li comms::option::SmallBufferStorage
 ///     @li comms::option::CustomStorageType
 ///     @li comms::option::SequenceSizeFieldPrefix
 ///     @li comms::option::SequenceSizeForcingEnabled
@@ -117,7 +129,9 @@ public:
     /// @details If comms::option::FixedSizeStorage option is NOT used, the
     ///     ValueType is std::string, otherwise it becomes
     ///     comms::util::StaticString<TSize>, where TSize is a size
-    ///     provided to comms::option::FixedSizeStorage option.
+    ///     provided to comms::option::FixedSizeStorage option. If
+    ///     comms::option::SmallBufferStorage option is used, the ValueType is
+    ///     comms::util::SmallString<TSize>.
     using ValueType = typename Base::ValueType;
 
     /// @brief Default constructor
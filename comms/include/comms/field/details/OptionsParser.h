@@ -55,6 +55,7 @@ public:
     static const bool HasFailOnInvalid = false;
     static const bool HasIgnoreInvalid = false;
     static const bool HasFixedSizeStorage = false;
+    static const bool HasSmallBufferStorage = false;
     static const bool HasCustomStorageType = false;
     static const bool HasScalingRatio = false;
     static const bool HasUnits = false;
@@ -401,11 +402,27 @@ class OptionsParser<
     comms::option::FixedSizeStorage<TSize>,
     TOptions...> : public OptionsParser<TOptions...>
 {
+    using Base = OptionsParser<TOptions...>;
+    static_assert(!Base::HasSmallBufferStorage,
+        "Cannot mix FixedSizeStorage and SmallBufferStorage options.");
 public:
     static const bool HasFixedSizeStorage = true;
     static const std::size_t FixedSizeStorage = TSize;
 };
 
+template <std::size_t TSize, typename... TOptions>
+class OptionsParser<
+    comms::option::SmallBufferStorage<TSize>,
+    TOptions...> : public OptionsParser<TOptions...>
+{
+    using Base = OptionsParser<TOptions...>;
+    static_assert(!Base::HasFixedSizeStorage,
+        "Cannot mix FixedSizeStorage and SmallBufferStorage options.");
+public:
+    static const bool HasSmallBufferStorage = true;
+    static const std::size_t SmallBufferStorage = TSize;
+};
+
 template <typename TType, typename... TOptions>
 class OptionsParser<
     comms::option::CustomStorageType<TType>,
@@ -323,6 +323,21 @@ struct NumValueSerOffset {};
 template <std::size_t TSize>
 struct FixedSizeStorage {};
 
+/// @brief Option that forces usage of embedded uninitialised data area for
+///     small number of elements and dynamic memory allocation for the rest.
+/// @details Applicable to fields that represent collection of raw data or other
+///     fields, such as comms::field::ArrayList or comms::field::String. If this
+///     option is used, it will force such fields to use comms::util::SmallVector
+///     or comms::util::SmallString, which keep up to TSize elements inline
+///     and spill to dynamically allocated storage only when more elements
+///     need to be stored. Unlike @ref FixedSizeStorage, there is no upper
+///     limit on the number of stored elements.
+/// @tparam TSize Number of elements stored without dynamic memory allocation,
+///     for strings it does @b NOT include the '\0' terminating character.
+/// @headerfile comms/options.h
+template <std::size_t TSize>
+struct SmallBufferStorage {};
+
 /// @brief Set custom storage type for fields like comms::field::String or
 ///     comms::field::ArrayList.
 /// @details By default comms::field::String uses
@@ -331,7 +346,8 @@ struct FixedSizeStorage {};
 ///     <a href="http://en.cppreference.com/w/cpp/container/vector">std::vector</a> as
 ///     their internal storage types. The @ref FixedSizeStorage option forces
 ///     them to use comms::util::StaticString and comms::util::StaticVector
-///     instead. This option can be used to provide any other third party type.
+///     instead, while the @ref SmallBufferStorage one forces them to use
+///     comms::util::SmallString and comms::util::SmallVector. This option can be used to provide any other third party type.
 ///     Such type must define the same public interface as @b std::string (when used
 ///     with comms::field::String) or @b std::vector (when used with
 ///     comms::field::ArrayList).
@@ -25,6 +25,7 @@
 #include "comms/util/Tuple.h"
 #include "comms/field/ArrayList.h"
 #include "comms/field/IntValue.h"
+#include "comms/MsgColumns.h"
 #include "ProtocolLayerBase.h"
 
 namespace comms
@@ -135,6 +136,47 @@ public:
         return result;
     }
 
+    /// @brief Read the message contents into columnar storage.
+    /// @details Invokes non-virtual @b doRead() member function of the message
+    ///     object reused by comms::MsgColumns and appends the decoded fields
+    ///     as a new row on success.
+    /// @tparam TMsg Type of the message.
+    /// @tparam TIter Type of iterator used for reading.
+    /// @param[in] inserter Object created by comms::MsgColumns::read().
+    /// @param[in, out] iter Iterator used for reading.
+    /// @param[in] size Number of bytes available for reading.
+    /// @param[out] missingSize Same as in read().
+    /// @return Status of the read operation.
+    template <typename TMsg, typename TIter>
+    static ErrorStatus read(
+        MsgColumnsInserter<TMsg>& inserter,
+        TIter& iter,
+        std::size_t size,
+        std::size_t* missingSize = nullptr)
+    {
+        static_assert(details::ProtocolLayerHasFieldsImpl<TMsg>::Value,
+            "The message is expected to provide its fields using comms::option::FieldsImpl option");
+
+        auto& msg = inserter.msg();
+        auto result = msg.doRead(iter, size);
+        if (result == ErrorStatus::Success) {
+            inserter.insert();
+            return result;
+        }
+
+        if ((result == ErrorStatus::NotEnoughData) &&
+            (missingSize != nullptr)) {
+            auto msgLen = getMsgLength(msg, MsgDirectLengthTag());
+            if (size < msgLen) {
+                *missingSize = msgLen - size;
+            }
+            else {
+                *missingSize = 1;
+            }
+        }
+        return result;
+    }
+
     /// @brief Read the message contents while caching the read transport
     ///     information fields.
     /// @details Very similar to read() member function, but adds "allFields"
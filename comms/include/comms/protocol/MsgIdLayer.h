@@ -32,6 +32,7 @@
 #include "ProtocolLayerBase.h"
 #include "comms/fields.h"
 #include "comms/MsgFactory.h"
+#include "comms/MsgColumns.h"
 
 namespace comms
 {
@@ -149,6 +150,48 @@ public:
         return readInternal(field, msgPtr, iter, size, missingSize, Base::createNextLayerReader());
     }
 
+    /// @brief Deserialise message of the known type into columnar storage.
+    /// @details Used by comms::MsgColumns::read(). Instead of creating
+    ///     message object using the message factory, the function compares
+    ///     the read message ID with the static ID of the @b TMsg type and
+    ///     forwards the read() request to the next layer only if they are equal.
+    /// @tparam TMsg Type of the message being decoded, must use
+    ///     comms::option::StaticNumIdImpl option.
+    /// @tparam TIter Type of iterator used for reading.
+    /// @param[in] inserter Object created by comms::MsgColumns::read().
+    /// @param[in, out] iter Input iterator used for reading.
+    /// @param[in] size Size of the data in the sequence
+    /// @param[out] missingSize Same as in the other read() member function.
+    /// @return Status of the operation, comms::ErrorStatus::InvalidMsgId
+    ///     in case the ID of the message is different.
+    template <typename TMsg, typename TIter>
+    ErrorStatus read(
+        MsgColumnsInserter<TMsg>& inserter,
+        TIter& iter,
+        std::size_t size,
+        std::size_t* missingSize = nullptr)
+    {
+        static_assert(details::ProtocolLayerHasStaticIdImpl<TMsg>::Value,
+            "The message is expected to define its ID using comms::option::StaticNumIdImpl option");
+
+        Field field;
+        auto es = field.read(iter, size);
+        if (es == ErrorStatus::NotEnoughData) {
+            Base::updateMissingSize(field, size, missingSize);
+        }
+
+        if (es != ErrorStatus::Success) {
+            return es;
+        }
+
+        if (field.value() != getMsgId(inserter.msg(), DirectIdTag())) {
+            return ErrorStatus::InvalidMsgId;
+        }
+
+        auto reader = Base::createNextLayerReader();
+        return reader.read(inserter, iter, size - field.length(), missingSize);
+    }
+
     /// @brief Deserialise message from the input data sequence while caching
     ///     the read transport information fields.
     /// @details Very similar to read() member function, but adds "allFields"
@@ -0,0 +1,880 @@
+//
+// Copyright 2016 (C). Alex Robenko. All rights reserved.
+//
+
+// This library is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file comms/util/SmallString.h
+/// This file contains the definition and implementation of the string with
+/// small buffer optimisation.
+
+#pragma once
+
+#include <cstddef>
+#include <algorithm>
+#include <iterator>
+#include <initializer_list>
+
+#include "comms/Assert.h"
+#include "SmallVector.h"
+
+namespace comms
+{
+
+namespace util
+{
+
+/// @brief Replacement to <a href="http://en.cppreference.com/w/cpp/string/basic_string">std::string</a>
+///     with small buffer optimisation.
+/// @details Strings of up to TSize characters are stored in the embedded
+///     uninitialised data area without any dynamic memory allocation, longer
+///     ones spill to the dynamically allocated storage. Provides
+///     commonly used subset of the
+///     <a href="http://en.cppreference.com/w/cpp/string/basic_string">std::string</a>
+///     interface.
+/// @tparam TSize Number of characters that can be stored without dynamic
+///     memory allocation, does @b NOT include the '\0' terminating character.
+/// @tparam TChar Type of the single character.
+/// @headerfile comms/util/SmallString.h
+template <std::size_t TSize, typename TChar = char>
+class SmallString
+{
+    using StorageType = SmallVector<TChar, TSize + 1>;
+    static const TChar Ends = static_cast<TChar>('\0');
+
+public:
+    /// @brief Type of single character.
+    using value_type = TChar;
+
+    /// @brief Type used for size information
+    using size_type = std::size_t;
+
+    /// @brief Type used in pointer arithmetics
+    using difference_type = std::ptrdiff_t;
+
+    /// @brief Reference to single character
+    using reference = value_type&;
+
+    /// @brief Const reference to single character
+    using const_reference = const value_type&;
+
+    /// @brief Pointer to single character
+    using pointer = value_type*;
+
+    /// @brief Const pointer to single character
+    using const_pointer = const value_type*;
+
+    /// @brief Type of the iterator.
+    using iterator = pointer;
+
+    /// @brief Type of the const iterator
+    using const_iterator = const_pointer;
+
+    /// @brief Type of the reverse iterator
+    using reverse_iterator = std::reverse_iterator<iterator>;
+
+    /// @brief Type of the const reverse iterator
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    /// @brief Same as std::string::npos.
+    static const size_type npos = static_cast<size_type>(-1);
+
+    /// @brief Default constructor
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/basic_string">Reference</a>
+    SmallString()
+    {
+        endString();
+    }
+
+    /// @brief Constructor
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/basic_string">Reference</a>
+    SmallString(size_type count, value_type ch)
+    {
+        assign(count, ch);
+    }
+
+    /// @brief Constructor
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/basic_string">Reference</a>
+    SmallString(const_pointer str, size_type count)
+    {
+        assign(str, count);
+    }
+
+    /// @brief Constructor
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/basic_string">Reference</a>
+    SmallString(const_pointer str)
+    {
+        assign(str);
+    }
+
+    /// @brief Constructor
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/basic_string">Reference</a>
+    template <typename TIter>
+    SmallString(TIter first, TIter last)
+    {
+        assign(first, last);
+    }
+
+    /// @brief Copy constructor
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/basic_string">Reference</a>
+    SmallString(const SmallString&) = default;
+
+    /// @brief Move constructor
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/basic_string">Reference</a>
+    SmallString(SmallString&& other)
+      : str_(std::move(other.str_))
+    {
+        other.endString();
+    }
+
+    /// @brief Constructor
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/basic_string">Reference</a>
+    SmallString(std::initializer_list<value_type> init)
+    {
+        assign(init);
+    }
+
+    /// @brief Destructor
+    ~SmallString() = default;
+
+    /// @brief Copy assignment
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/operator%3D">Reference</a>
+    SmallString& operator=(const SmallString&) = default;
+
+    /// @brief Move assignment
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/operator%3D">Reference</a>
+    SmallString& operator=(SmallString&& other)
+    {
+        if (&other != this) {
+            str_ = std::move(other.str_);
+            other.endString();
+        }
+        return *this;
+    }
+
+    /// @brief Assignment operator
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/operator%3D">Reference</a>
+    SmallString& operator=(const_pointer str)
+    {
+        return assign(str);
+    }
+
+    /// @brief Assignment operator
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/operator%3D">Reference</a>
+    SmallString& operator=(value_type ch)
+    {
+        return assign(1, ch);
+    }
+
+    /// @brief Assignment operator
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/operator%3D">Reference</a>
+    SmallString& operator=(std::initializer_list<value_type> init)
+    {
+        return assign(init);
+    }
+
+    /// @brief Assign characters to a string
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/assign">Reference</a>
+    SmallString& assign(size_type count, value_type ch)
+    {
+        str_.assign(count, ch);
+        endString();
+        return *this;
+    }
+
+    /// @brief Assign characters to a string
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/assign">Reference</a>
+    SmallString& assign(const SmallString& other)
+    {
+        return operator=(other);
+    }
+
+    /// @brief Assign characters to a string
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/assign">Reference</a>
+    SmallString& assign(const_pointer str, size_type count)
+    {
+        return assign(str, str + count);
+    }
+
+    /// @brief Assign characters to a string
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/assign">Reference</a>
+    SmallString& assign(const_pointer str)
+    {
+        GASSERT(str != nullptr);
+        return assign(str, strlen(str));
+    }
+
+    /// @brief Assign characters to a string
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/assign">Reference</a>
+    template <typename TIter>
+    SmallString& assign(TIter first, TIter last)
+    {
+        str_.assign(first, last);
+        endString();
+        return *this;
+    }
+
+    /// @brief Assign characters to a string
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/assign">Reference</a>
+    SmallString& assign(std::initializer_list<value_type> init)
+    {
+        return assign(init.begin(), init.end());
+    }
+
+    /// @brief Access specified character with bounds checking.
+    /// @details The bounds check is performed with GASSERT() macro, which means
+    ///     it is performed only in DEBUG mode compilation. In case NDEBUG
+    ///     symbol is defined (RELEASE mode compilation), this call is equivalent
+    ///     to operator[]().
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/at">Reference</a>
+    reference at(size_type pos)
+    {
+        GASSERT(pos < size());
+        return str_[pos];
+    }
+
+    /// @brief Access specified character with bounds checking.
+    /// @details The bounds check is performed with GASSERT() macro, which means
+    ///     it is performed only in DEBUG mode compilation. In case NDEBUG
+    ///     symbol is defined (RELEASE mode compilation), this call is equivalent
+    ///     to operator[]().
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/at">Reference</a>
+    const_reference at(size_type pos) const
+    {
+        GASSERT(pos < size());
+        return str_[pos];
+    }
+
+    /// @brief Access specified character without bounds checking.
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/operator_at">Reference</a>
+    reference operator[](size_type pos)
+    {
+        return str_[pos];
+    }
+
+    /// @brief Access specified character without bounds checking.
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/operator_at">Reference</a>
+    const_reference operator[](size_type pos) const
+    {
+        return str_[pos];
+    }
+
+    /// @brief Accesses the first character.
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/front">Reference</a>
+    /// @pre The string is not empty.
+    reference front()
+    {
+        GASSERT(!empty());
+        return str_.front();
+    }
+
+    /// @brief Accesses the first character.
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/front">Reference</a>
+    /// @pre The string is not empty.
+    const_reference front() const
+    {
+        GASSERT(!empty());
+        return str_.front();
+    }
+
+    /// @brief Accesses the last character.
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/back">Reference</a>
+    /// @pre The string is not empty.
+    reference back()
+    {
+        GASSERT(!empty());
+        return str_[size() - 1];
+    }
+
+    /// @brief Accesses the last character.
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/back">Reference</a>
+    /// @pre The string is not empty.
+    const_reference back() const
+    {
+        GASSERT(!empty());
+        return str_[size() - 1];
+    }
+
+    /// @brief Returns a pointer to the first character of a string.
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/data">Reference</a>
+    const_pointer data() const
+    {
+        return str_.data();
+    }
+
+    /// @brief Returns a non-modifiable standard C character array version of the string.
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/c_str">Reference</a>
+    const_pointer c_str() const
+    {
+        return data();
+    }
+
+    /// @brief Returns an iterator to the beginning.
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/begin">Reference</a>
+    iterator begin()
+    {
+        return str_.begin();
+    }
+
+    /// @brief Returns an iterator to the beginning.
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/begin">Reference</a>
+    const_iterator begin() const
+    {
+        return cbegin();
+    }
+
+    /// @brief Returns an iterator to the beginning.
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/begin">Reference</a>
+    const_iterator cbegin() const
+    {
+        return str_.cbegin();
+    }
+
+    /// @brief Returns an iterator to the end.
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/end">Reference</a>
+    iterator end()
+    {
+        return begin() + size();
+    }
+
+    /// @brief Returns an iterator to the end.
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/end">Reference</a>
+    const_iterator end() const
+    {
+        return cend();
+    }
+
+    /// @brief Returns an iterator to the end.
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/end">Reference</a>
+    const_iterator cend() const
+    {
+        return cbegin() + size();
+    }
+
+    /// @brief Returns a reverse iterator to the beginning.
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/rbegin">Reference</a>
+    reverse_iterator rbegin()
+    {
+        return reverse_iterator(end());
+    }
+
+    /// @brief Returns a reverse iterator to the beginning.
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/rbegin">Reference</a>
+    const_reverse_iterator rbegin() const
+    {
+        return crbegin();
+    }
+
+    /// @brief Returns a reverse iterator to the beginning.
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/rbegin">Reference</a>
+    const_reverse_iterator crbegin() const
+    {
+        return const_reverse_iterator(cend());
+    }
+
+    /// @brief Returns a reverse iterator to the end.
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/rend">Reference</a>
+    reverse_iterator rend()
+    {
+        return reverse_iterator(begin());
+    }
+
+    /// @brief Returns a reverse iterator to the end.
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/rend">Reference</a>
+    const_reverse_iterator rend() const
+    {
+        return crend();
+    }
+
+    /// @brief Returns a reverse iterator to the end.
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/rend">Reference</a>
+    const_reverse_iterator crend() const
+    {
+        return const_reverse_iterator(cbegin());
+    }
+
+    /// @brief Checks whether the string is empty.
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/empty">Reference</a>
+    bool empty() const
+    {
+        return size() == 0U;
+    }
+
+    /// @brief Returns the number of characters.
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/size">Reference</a>
+    size_type size() const
+    {
+        GASSERT(!str_.empty());
+        return str_.size() - 1;
+    }
+
+    /// @brief Returns the number of characters.
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/size">Reference</a>
+    size_type length() const
+    {
+        return size();
+    }
+
+    /// @brief Returns the maximum number of characters.
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/max_size">Reference</a>
+    size_type max_size() const
+    {
+        return str_.max_size() - 1;
+    }
+
+    /// @brief Reserves storage.
+    /// @details Dynamic memory allocation is performed only if requested
+    ///     capacity exceeds the currently available one.
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/reserve">Reference</a>
+    void reserve(size_type new_cap)
+    {
+        str_.reserve(new_cap + 1);
+    }
+
+    /// @brief returns the number of characters that can be held in currently allocated storage.
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/capacity">Reference</a>
+    size_type capacity() const
+    {
+        return str_.capacity() - 1;
+    }
+
+    /// @brief Returns the number of characters that can be held without any
+    ///     dynamic memory allocation.
+    /// @return TSize provided as template argument.
+    static constexpr size_type inlineCapacity()
+    {
+        return TSize;
+    }
+
+    /// @brief Check whether the characters are stored in the embedded data area.
+    bool isInlined() const
+    {
+        return str_.isInlined();
+    }
+
+    /// @brief Reduces memory usage by freeing unused memory.
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/shrink_to_fit">Reference</a>
+    void shrink_to_fit()
+    {
+        str_.shrink_to_fit();
+    }
+
+    /// @brief Clears the contents.
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/clear">Reference</a>
+    void clear()
+    {
+        str_.clear();
+        endString();
+    }
+
+    /// @brief Inserts characters.
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/insert">Reference</a>
+    SmallString& insert(size_type idx, size_type count, value_type ch)
+    {
+        GASSERT(idx <= size());
+        str_.insert(str_.begin() + idx, count, ch);
+        return *this;
+    }
+
+    /// @brief Inserts characters.
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/insert">Reference</a>
+    SmallString& insert(size_type idx, const_pointer str)
+    {
+        GASSERT(str != nullptr);
+        return insert(idx, str, strlen(str));
+    }
+
+    /// @brief Inserts characters.
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/insert">Reference</a>
+    SmallString& insert(size_type idx, const_pointer str, size_type count)
+    {
+        GASSERT(idx <= size());
+        str_.insert(str_.begin() + idx, str, str + count);
+        return *this;
+    }
+
+    /// @brief Inserts characters.
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/insert">Reference</a>
+    SmallString& insert(size_type idx, const SmallString& other)
+    {
+        return insert(idx, other.data(), other.size());
+    }
+
+    /// @brief Inserts characters.
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/insert">Reference</a>
+    iterator insert(const_iterator pos, value_type ch)
+    {
+        GASSERT(pos <= cend());
+        return str_.insert(pos, ch);
+    }
+
+    /// @brief Inserts characters.
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/insert">Reference</a>
+    iterator insert(const_iterator pos, size_type count, value_type ch)
+    {
+        GASSERT(pos <= cend());
+        return str_.insert(pos, count, ch);
+    }
+
+    /// @brief Inserts characters.
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/insert">Reference</a>
+    template <typename TIter>
+    iterator insert(const_iterator pos, TIter first, TIter last)
+    {
+        GASSERT(pos <= cend());
+        return str_.insert(pos, first, last);
+    }
+
+    /// @brief Removes characters.
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/erase">Reference</a>
+    SmallString& erase(size_type idx, size_type count = npos)
+    {
+        GASSERT(idx <= size());
+        auto endIdx = idx + std::min(count, size() - idx);
+        str_.erase(str_.begin() + idx, str_.begin() + endIdx);
+        return *this;
+    }
+
+    /// @brief Removes characters.
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/erase">Reference</a>
+    iterator erase(const_iterator pos)
+    {
+        GASSERT(pos < cend());
+        return str_.erase(pos);
+    }
+
+    /// @brief Removes characters.
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/erase">Reference</a>
+    iterator erase(const_iterator first, const_iterator last)
+    {
+        GASSERT(last <= cend());
+        return str_.erase(first, last);
+    }
+
+    /// @brief Appends a character to the end.
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/push_back">Reference</a>
+    void push_back(value_type ch)
+    {
+        str_.back() = ch;
+        str_.push_back(value_type(Ends));
+    }
+
+    /// @brief Removes the last character.
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/pop_back">Reference</a>
+    void pop_back()
+    {
+        GASSERT(!empty());
+        str_.pop_back();
+        str_.back() = Ends;
+    }
+
+    /// @brief Appends characters to the end.
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/append">Reference</a>
+    SmallString& append(size_type count, value_type ch)
+    {
+        return insert(size(), count, ch);
+    }
+
+    /// @brief Appends characters to the end.
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/append">Reference</a>
+    SmallString& append(const SmallString& other)
+    {
+        return insert(size(), other);
+    }
+
+    /// @brief Appends characters to the end.
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/append">Reference</a>
+    SmallString& append(const_pointer str, size_type count)
+    {
+        return insert(size(), str, count);
+    }
+
+    /// @brief Appends characters to the end.
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/append">Reference</a>
+    SmallString& append(const_pointer str)
+    {
+        return insert(size(), str);
+    }
+
+    /// @brief Appends characters to the end.
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/append">Reference</a>
+    template <typename TIter>
+    SmallString& append(TIter first, TIter last)
+    {
+        insert(cend(), first, last);
+        return *this;
+    }
+
+    /// @brief Appends characters to the end.
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/operator%2B%3D">Reference</a>
+    SmallString& operator+=(const SmallString& other)
+    {
+        return append(other);
+    }
+
+    /// @brief Appends characters to the end.
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/operator%2B%3D">Reference</a>
+    SmallString& operator+=(value_type ch)
+    {
+        push_back(ch);
+        return *this;
+    }
+
+    /// @brief Appends characters to the end.
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/operator%2B%3D">Reference</a>
+    SmallString& operator+=(const_pointer str)
+    {
+        return append(str);
+    }
+
+    /// @brief Compares two strings.
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/compare">Reference</a>
+    int compare(const_pointer str, size_type count) const
+    {
+        auto minLen = std::min(size(), count);
+        for (size_type idx = 0U; idx < minLen; ++idx) {
+            auto diff = static_cast<int>(str_[idx]) - static_cast<int>(str[idx]);
+            if (diff != 0) {
+                return diff;
+            }
+        }
+
+        if (size() < count) {
+            return -1;
+        }
+
+        if (count < size()) {
+            return 1;
+        }
+
+        return 0;
+    }
+
+    /// @brief Compares two strings.
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/compare">Reference</a>
+    int compare(const_pointer str) const
+    {
+        GASSERT(str != nullptr);
+        return compare(str, strlen(str));
+    }
+
+    /// @brief Compares two strings.
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/compare">Reference</a>
+    template <std::size_t TOtherSize>
+    int compare(const SmallString<TOtherSize, TChar>& other) const
+    {
+        return compare(other.data(), other.size());
+    }
+
+    /// @brief Changes the number of characters stored.
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/resize">Reference</a>
+    void resize(size_type count)
+    {
+        resize(count, Ends);
+    }
+
+    /// @brief Changes the number of characters stored.
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/resize">Reference</a>
+    void resize(size_type count, value_type ch)
+    {
+        str_.back() = ch;
+        str_.resize(count + 1, ch);
+        str_.back() = Ends;
+    }
+
+    /// @brief Swaps the contents of two strings.
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/swap">Reference</a>
+    void swap(SmallString& other)
+    {
+        str_.swap(other.str_);
+    }
+
+    /// @brief Find characters in the string.
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/find">Reference</a>
+    size_type find(value_type ch, size_type pos = 0) const
+    {
+        if (size() <= pos) {
+            return npos;
+        }
+
+        auto iter = std::find(cbegin() + pos, cend(), ch);
+        if (iter == cend()) {
+            return npos;
+        }
+
+        return static_cast<size_type>(std::distance(cbegin(), iter));
+    }
+
+    /// @brief Find characters in the string.
+    /// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/find">Reference</a>
+    size_type find(const_pointer str, size_type pos = 0) const
+    {
+        GASSERT(str != nullptr);
+        auto count = strlen(str);
+        if (size() < (pos + count)) {
+            return npos;
+        }
+
+        auto iter = std::search(cbegin() + pos, cend(), str, str + count);
+        if ((iter == cend()) && (0U < count)) {
+            return npos;
+        }
+
+        return static_cast<size_type>(std::distance(cbegin(), iter));
+    }
+
+private:
+    void endString()
+    {
+        str_.push_back(value_type(Ends));
+    }
+
+    static size_type strlen(const_pointer str)
+    {
+        auto* strTmp = str;
+        while (*strTmp != Ends) {
+            ++strTmp;
+        }
+
+        return static_cast<size_type>(strTmp - str);
+    }
+
+    StorageType str_;
+};
+
+/// @brief Lexicographical compare between the strings.
+/// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/operator_cmp">Reference</a>
+/// @related SmallString
+template <std::size_t TSize1, std::size_t TSize2, typename TChar>
+bool operator<(const SmallString<TSize1, TChar>& str1, const SmallString<TSize2, TChar>& str2)
+{
+    return std::lexicographical_compare(str1.begin(), str1.end(), str2.begin(), str2.end());
+}
+
+/// @brief Lexicographical compare between the strings.
+/// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/operator_cmp">Reference</a>
+/// @related SmallString
+template <std::size_t TSize, typename TChar>
+bool operator<(const SmallString<TSize, TChar>& str1, const TChar* str2)
+{
+    return str1.compare(str2) < 0;
+}
+
+/// @brief Lexicographical compare between the strings.
+/// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/operator_cmp">Reference</a>
+/// @related SmallString
+template <std::size_t TSize, typename TChar>
+bool operator<(const TChar* str1, const SmallString<TSize, TChar>& str2)
+{
+    return 0 < str2.compare(str1);
+}
+
+/// @brief Lexicographical compare between the strings.
+/// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/operator_cmp">Reference</a>
+/// @related SmallString
+template <std::size_t TSize1, std::size_t TSize2, typename TChar>
+bool operator<=(const SmallString<TSize1, TChar>& str1, const SmallString<TSize2, TChar>& str2)
+{
+    return !(str2 < str1);
+}
+
+/// @brief Lexicographical compare between the strings.
+/// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/operator_cmp">Reference</a>
+/// @related SmallString
+template <std::size_t TSize1, std::size_t TSize2, typename TChar>
+bool operator>(const SmallString<TSize1, TChar>& str1, const SmallString<TSize2, TChar>& str2)
+{
+    return str2 < str1;
+}
+
+/// @brief Lexicographical compare between the strings.
+/// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/operator_cmp">Reference</a>
+/// @related SmallString
+template <std::size_t TSize1, std::size_t TSize2, typename TChar>
+bool operator>=(const SmallString<TSize1, TChar>& str1, const SmallString<TSize2, TChar>& str2)
+{
+    return !(str1 < str2);
+}
+
+/// @brief Equality compare between the strings.
+/// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/operator_cmp">Reference</a>
+/// @related SmallString
+template <std::size_t TSize1, std::size_t TSize2, typename TChar>
+bool operator==(const SmallString<TSize1, TChar>& str1, const SmallString<TSize2, TChar>& str2)
+{
+    return str1.compare(str2) == 0;
+}
+
+/// @brief Equality compare between the strings.
+/// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/operator_cmp">Reference</a>
+/// @related SmallString
+template <std::size_t TSize, typename TChar>
+bool operator==(const SmallString<TSize, TChar>& str1, const TChar* str2)
+{
+    return str1.compare(str2) == 0;
+}
+
+/// @brief Equality compare between the strings.
+/// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/operator_cmp">Reference</a>
+/// @related SmallString
+template <std::size_t TSize, typename TChar>
+bool operator==(const TChar* str1, const SmallString<TSize, TChar>& str2)
+{
+    return str2.compare(str1) == 0;
+}
+
+/// @brief Inequality compare between the strings.
+/// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/operator_cmp">Reference</a>
+/// @related SmallString
+template <std::size_t TSize1, std::size_t TSize2, typename TChar>
+bool operator!=(const SmallString<TSize1, TChar>& str1, const SmallString<TSize2, TChar>& str2)
+{
+    return !(str1 == str2);
+}
+
+/// @brief Inequality compare between the strings.
+/// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/operator_cmp">Reference</a>
+/// @related SmallString
+template <std::size_t TSize, typename TChar>
+bool operator!=(const SmallString<TSize, TChar>& str1, const TChar* str2)
+{
+    return !(str1 == str2);
+}
+
+/// @brief Inequality compare between the strings.
+/// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/operator_cmp">Reference</a>
+/// @related SmallString
+template <std::size_t TSize, typename TChar>
+bool operator!=(const TChar* str1, const SmallString<TSize, TChar>& str2)
+{
+    return !(str2 == str1);
+}
+
+}  // namespace util
+
+}  // namespace comms
+
+namespace std
+{
+
+/// @brief Specializes the std::swap algorithm.
+/// @see <a href="http://en.cppreference.com/w/cpp/string/basic_string/swap2">Reference</a>
+/// @related comms::util::SmallString
+template <std::size_t TSize, typename TChar>
+void swap(comms::util::SmallString<TSize, TChar>& str1, comms::util::SmallString<TSize, TChar>& str2)
+{
+    str1.swap(str2);
+}
+
+}
@@ -0,0 +1,811 @@
+//
+// Copyright 2016 (C). Alex Robenko. All rights reserved.
+//
+
+// This library is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file comms/util/SmallVector.h
+/// This file contains the definition and implementation of the vector with
+/// small buffer optimisation.
+
+#pragma once
+
+#include <cstddef>
+#include <array>
+#include <algorithm>
+#include <iterator>
+#include <utility>
+#include <type_traits>
+#include <initializer_list>
+#include <new>
+
+#include "comms/Assert.h"
+
+namespace comms
+{
+
+namespace util
+{
+
+/// @brief Replacement to <a href="http://en.cppreference.com/w/cpp/container/vector">std::vector</a>
+///     with small buffer optimisation.
+/// @details Stores up to TSize elements in the embedded uninitialised data
+///     area (just like comms::util::StaticVector) and switches to dynamically
+///     allocated storage only when more elements need to be stored. As the
+///     result the common short sequences don't require any dynamic memory
+///     allocation, while the rare long ones are still supported. Provides
+///     almost the same interface as
+///     <a href="http://en.cppreference.com/w/cpp/container/vector">std::vector</a>.
+/// @tparam T Type of the stored elements.
+/// @tparam TSize Number of elements that can be stored without dynamic
+///     memory allocation.
+/// @headerfile comms/util/SmallVector.h
+template <typename T, std::size_t TSize>
+class SmallVector
+{
+    using ElementType = typename std::aligned_storage<
+        sizeof(T),
+        std::alignment_of<T>::value
+    >::type;
+
+    using StorageType = std::array<ElementType, TSize>;
+
+public:
+    /// @brief Type of single element.
+    using value_type = T;
+
+    /// @brief Type used for size information
+    using size_type = std::size_t;
+
+    /// @brief Type used in pointer arithmetics
+    using difference_type = std::ptrdiff_t;
+
+    /// @brief Reference to single element
+    using reference = T&;
+
+    /// @brief Const reference to single element
+    using const_reference = const T&;
+
+    /// @brief Pointer to single element
+    using pointer = T*;
+
+    /// @brief Const pointer to single element
+    using const_pointer = const T*;
+
+    /// @brief Type of the iterator.
+    using iterator = pointer;
+
+    /// @brief Type of the const iterator
+    using const_iterator = const_pointer;
+
+    /// @brief Type of the reverse iterator
+    using reverse_iterator = std::reverse_iterator<iterator>;
+
+    /// @brief Type of the const reverse iterator
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    /// @brief Default constructor.
+    SmallVector()
+      : data_(inlineData()),
+        capacity_(TSize)
+    {
+    }
+
+    /// @brief Constructor
+    /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/vector">Reference</a>
+    SmallVector(size_type count, const T& value)
+      : SmallVector()
+    {
+        assign(count, value);
+    }
+
+    /// @brief Constructor
+    /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/vector">Reference</a>
+    explicit SmallVector(size_type count)
+      : SmallVector()
+    {
+        resize(count);
+    }
+
+    /// @brief Constructor
+    /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/vector">Reference</a>
+    template <typename TIter>
+    SmallVector(TIter from, TIter to)
+      : SmallVector()
+    {
+        assign(from, to);
+    }
+
+    /// @brief Copy constructor
+    /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/vector">Reference</a>
+    SmallVector(const SmallVector& other)
+      : SmallVector()
+    {
+        assign(other.begin(), other.end());
+    }
+
+    /// @brief Move constructor
+    /// @details If the other vector uses dynamically allocated storage, it
+    ///     is taken over without moving any elements.
+    /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/vector">Reference</a>
+    SmallVector(SmallVector&& other)
+      : SmallVector()
+    {
+        takeFrom(std::move(other));
+    }
+
+    /// @brief Constructor
+    /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/vector">Reference</a>
+    SmallVector(std::initializer_list<value_type> init)
+      : SmallVector()
+    {
+        assign(init.begin(), init.end());
+    }
+
+    /// @brief Destructor
+    ~SmallVector()
+    {
+        clear();
+        releaseStorage();
+    }
+
+    /// @brief Copy assignement
+    /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/operator%3D">Reference</a>
+    SmallVector& operator=(const SmallVector& other)
+    {
+        if (&other == this) {
+            return *this;
+        }
+
+        assign(other.begin(), other.end());
+        return *this;
+    }
+
+    /// @brief Move assignement
+    /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/operator%3D">Reference</a>
+    SmallVector& operator=(SmallVector&& other)
+    {
+        if (&other == this) {
+            return *this;
+        }
+
+        clear();
+        takeFrom(std::move(other));
+        return *this;
+    }
+
+    /// @brief Copy assignement
+    /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/operator%3D">Reference</a>
+    SmallVector& operator=(std::initializer_list<value_type> init)
+    {
+        assign(init);
+        return *this;
+    }
+
+    /// @brief Assigns values to the container.
+    /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/assign">Reference</a>
+    void assign(size_type count, const T& value)
+    {
+        // The value may refer to the element being destructed
+        T tmp(value);
+        clear();
+        reserve(count);
+        while (0 < count) {
+            push_back(tmp);
+            --count;
+        }
+    }
+
+    /// @brief Assigns values to the container.
+    /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/assign">Reference</a>
+    template <typename TIter>
+    void assign(TIter from, TIter to)
+    {
+        clear();
+        reserveForRange(from, to, typename std::iterator_traits<TIter>::iterator_category());
+        for (; from != to; ++from) {
+            push_back(*from);
+        }
+    }
+
+    /// @brief Assigns values to the container.
+    /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/assign">Reference</a>
+    void assign(std::initializer_list<value_type> init)
+    {
+        assign(init.begin(), init.end());
+    }
+
+    /// @brief Access specified element with bounds checking.
+    /// @details The bounds check is performed with GASSERT() macro, which means
+    ///     it is performed only in DEBUG mode compilation. In case NDEBUG
+    ///     symbol is defined (RELEASE mode compilation), this call is equivalent
+    ///     to operator[]().
+    /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/at">Reference</a>
+    reference at(size_type pos)
+    {
+        GASSERT(pos < size());
+        return data_[pos];
+    }
+
+    /// @brief Access specified element with bounds checking.
+    /// @details The bounds check is performed with GASSERT() macro, which means
+    ///     it is performed only in DEBUG mode compilation. In case NDEBUG
+    ///     symbol is defined (RELEASE mode compilation), this call is equivalent
+    ///     to operator[]().
+    /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/at">Reference</a>
+    const_reference at(size_type pos) const
+    {
+        GASSERT(pos < size());
+        return data_[pos];
+    }
+
+    /// @brief Access specified element without bounds checking.
+    /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/operator_at">Reference</a>
+    reference operator[](size_type pos)
+    {
+        return data_[pos];
+    }
+
+    /// @brief Access specified element without bounds checking.
+    /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/operator_at">Reference</a>
+    const_reference operator[](size_type pos) const
+    {
+        return data_[pos];
+    }
+
+    /// @brief Access the first element.
+    /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/front">Reference</a>
+    /// @pre The vector is not empty.
+    reference front()
+    {
+        GASSERT(!empty());
+        return data_[0];
+    }
+
+    /// @brief Access the first element.
+    /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/front">Reference</a>
+    /// @pre The vector is not empty.
+    const_reference front() const
+    {
+        GASSERT(!empty());
+        return data_[0];
+    }
+
+    /// @brief Access the last element.
+    /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/back">Reference</a>
+    /// @pre The vector is not empty.
+    reference back()
+    {
+        GASSERT(!empty());
+        return data_[size_ - 1];
+    }
+
+    /// @brief Access the last element.
+    /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/back">Reference</a>
+    /// @pre The vector is not empty.
+    const_reference back() const
+    {
+        GASSERT(!empty());
+        return data_[size_ - 1];
+    }
+
+    /// @brief Direct access to the underlying array.
+    /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/data">Reference</a>
+    pointer data()
+    {
+        return data_;
+    }
+
+    /// @brief Direct access to the underlying array.
+    /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/data">Reference</a>
+    const_pointer data() const
+    {
+        return data_;
+    }
+
+    /// @brief Returns an iterator to the beginning.
+    /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/begin">Reference</a>
+    iterator begin()
+    {
+        return data_;
+    }
+
+    /// @brief Returns an iterator to the beginning.
+    /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/begin">Reference</a>
+    const_iterator begin() const
+    {
+        return cbegin();
+    }
+
+    /// @brief Returns an iterator to the beginning.
+    /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/begin">Reference</a>
+    const_iterator cbegin() const
+    {
+        return data_;
+    }
+
+    /// @brief Returns an iterator to the end.
+    /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/end">Reference</a>
+    iterator end()
+    {
+        return data_ + size_;
+    }
+
+    /// @brief Returns an iterator to the end.
+    /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/end">Reference</a>
+    const_iterator end() const
+    {
+        return cend();
+    }
+
+    /// @brief Returns an iterator to the end.
+    /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/end">Reference</a>
+    const_iterator cend() const
+    {
+        return data_ + size_;
+    }
+
+    /// @brief Returns a reverse iterator to the beginning.
+    /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/rbegin">Reference</a>
+    reverse_iterator rbegin()
+    {
+        return reverse_iterator(end());
+    }
+
+    /// @brief Returns a reverse iterator to the beginning.
+    /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/rbegin">Reference</a>
+    const_reverse_iterator rbegin() const
+    {
+        return crbegin();
+    }
+
+    /// @brief Returns a reverse iterator to the beginning.
+    /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/rbegin">Reference</a>
+    const_reverse_iterator crbegin() const
+    {
+        return const_reverse_iterator(cend());
+    }
+
+    /// @brief Returns a reverse iterator to the end.
+    /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/rend">Reference</a>
+    reverse_iterator rend()
+    {
+        return reverse_iterator(begin());
+    }
+
+    /// @brief Returns a reverse iterator to the end.
+    /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/rend">Reference</a>
+    const_reverse_iterator rend() const
+    {
+        return crend();
+    }
+
+    /// @brief Returns a reverse iterator to the end.
+    /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/rend">Reference</a>
+    const_reverse_iterator crend() const
+    {
+        return const_reverse_iterator(cbegin());
+    }
+
+    /// @brief Checks whether the container is empty.
+    /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/empty">Reference</a>
+    bool empty() const
+    {
+        return size_ == 0U;
+    }
+
+    /// @brief Returns the number of elements.
+    /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/size">Reference</a>
+    size_type size() const
+    {
+        return size_;
+    }
+
+    /// @brief Returns the maximum possible number of elements.
+    /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/max_size">Reference</a>
+    size_type max_size() const
+    {
+        return static_cast<size_type>(-1) / sizeof(T);
+    }
+
+    /// @brief Reserves storage.
+    /// @details Dynamic memory allocation is performed only if requested
+    ///     capacity exceeds the currently available one.
+    /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/reserve">Reference</a>
+    void reserve(size_type new_cap)
+    {
+        if (new_cap <= capacity_) {
+            return;
+        }
+
+        reallocate(new_cap);
+    }
+
+    /// @brief Returns the number of elements that can be held in currently allocated storage.
+    /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/capacity">Reference</a>
+    size_type capacity() const
+    {
+        return capacity_;
+    }
+
+    /// @brief Returns the number of elements that can be held without any
+    ///     dynamic memory allocation.
+    /// @return TSize provided as template argument.
+    static constexpr size_type inlineCapacity()
+    {
+        return TSize;
+    }
+
+    /// @brief Check whether the elements are stored in the embedded data area.
+    bool isInlined() const
+    {
+        return data_ == inlineData();
+    }
+
+    /// @brief Reduces memory usage by freeing unused memory.
+    /// @details If the elements fit into the embedded data area, they are
+    ///     moved back there and dynamically allocated storage is released.
+    /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/shrink_to_fit">Reference</a>
+    void shrink_to_fit()
+    {
+        if (isInlined() || (capacity_ == size_)) {
+            return;
+        }
+
+        reallocate(size_);
+    }
+
+    /// @brief Clears the contents.
+    /// @details Dynamically allocated storage (if such exists) is preserved.
+    /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/clear">Reference</a>
+    void clear()
+    {
+        destruct(begin(), end());
+        size_ = 0U;
+    }
+
+    /// @brief Inserts elements.
+    /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/insert">Reference</a>
+    iterator insert(const_iterator iter, const T& value)
+    {
+        return emplace(iter, value);
+    }
+
+    /// @brief Inserts elements.
+    /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/insert">Reference</a>
+    iterator insert(const_iterator iter, T&& value)
+    {
+        return emplace(iter, std::move(value));
+    }
+
+    /// @brief Inserts elements.
+    /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/insert">Reference</a>
+    iterator insert(const_iterator iter, size_type count, const T& value)
+    {
+        auto idx = indexOf(iter);
+        auto origSize = size_;
+        // The value may refer to the element being moved by the
+        // reallocation.
+        T tmp(value);
+        reserve(origSize + count);
+        for (auto num = count; 0 < num; --num) {
+            push_back(tmp);
+        }
+        std::rotate(begin() + idx, begin() + origSize, end());
+        return begin() + idx;
+    }
+
+    /// @brief Inserts elements.
+    /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/insert">Reference</a>
+    template <typename TIter>
+    iterator insert(const_iterator iter, TIter from, TIter to)
+    {
+        auto idx = indexOf(iter);
+        auto origSize = size_;
+        reserveForRange(from, to, typename std::iterator_traits<TIter>::iterator_category(), origSize);
+        for (; from != to; ++from) {
+            push_back(*from);
+        }
+        std::rotate(begin() + idx, begin() + origSize, end());
+        return begin() + idx;
+    }
+
+    /// @brief Inserts elements.
+    /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/insert">Reference</a>
+    iterator insert(const_iterator iter, std::initializer_list<value_type> init)
+    {
+        return insert(iter, init.begin(), init.end());
+    }
+
+    /// @brief Constructs elements in place.
+    /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/emplace">Reference</a>
+    template <typename... TArgs>
+    iterator emplace(const_iterator iter, TArgs&&... args)
+    {
+        auto idx = indexOf(iter);
+        emplace_back(std::forward<TArgs>(args)...);
+        std::rotate(begin() + idx, end() - 1, end());
+        return begin() + idx;
+    }
+
+    /// @brief Erases elements.
+    /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/erase">Reference</a>
+    iterator erase(const_iterator iter)
+    {
+        return erase(iter, iter + 1);
+    }
+
+    /// @brief Erases elements.
+    /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/erase">Reference</a>
+    iterator erase(const_iterator from, const_iterator to)
+    {
+        auto fromIdx = indexOf(from);
+        auto toIdx = indexOf(to);
+        GASSERT(fromIdx <= toIdx);
+        auto newEnd = std::move(begin() + toIdx, end(), begin() + fromIdx);
+        destruct(newEnd, end());
+        size_ -= (toIdx - fromIdx);
+        return begin() + fromIdx;
+    }
+
+    /// @brief Adds an element to the end.
+    /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/push_back">Reference</a>
+    void push_back(const T& value)
+    {
+        emplace_back(value);
+    }
+
+    /// @brief Adds an element to the end.
+    /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/push_back">Reference</a>
+    void push_back(T&& value)
+    {
+        emplace_back(std::move(value));
+    }
+
+    /// @brief Constructs an element in place at the end.
+    /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/emplace_back">Reference</a>
+    template <typename... TArgs>
+    void emplace_back(TArgs&&... args)
+    {
+        if (size_ == capacity_) {
+            // The arguments may refer to the existing elements,
+            // construct the new one before reallocation.
+            T tmp(std::forward<TArgs>(args)...);
+            reallocate(std::max(size_ + 1, capacity_ * 2));
+            new (data_ + size_) T(std::move(tmp));
+            ++size_;
+            return;
+        }
+
+        new (data_ + size_) T(std::forward<TArgs>(args)...);
+        ++size_;
+    }
+
+    /// @brief Removes the last element.
+    /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/pop_back">Reference</a>
+    void pop_back()
+    {
+        GASSERT(!empty());
+        back().~T();
+        --size_;
+    }
+
+    /// @brief Changes the number of elements stored.
+    /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/resize">Reference</a>
+    void resize(size_type count)
+    {
+        reserve(count);
+        while (count < size_) {
+            pop_back();
+        }
+
+        while (size_ < count) {
+            emplace_back();
+        }
+    }
+
+    /// @brief Changes the number of elements stored.
+    /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/resize">Reference</a>
+    void resize(size_type count, const value_type& value)
+    {
+        // The value may refer to the element being moved or destructed
+        T tmp(value);
+        reserve(count);
+        while (count < size_) {
+            pop_back();
+        }
+
+        while (size_ < count) {
+            push_back(tmp);
+        }
+    }
+
+    /// @brief Swaps the contents.
+    /// @see <a href="http://en.cppreference.com/w/cpp/container/vector/swap">Reference</a>
+    void swap(SmallVector& other)
+    {
+        SmallVector tmp(std::move(other));
+        other = std::move(*this);
+        *this = std::move(tmp);
+    }
+
+private:
+    pointer inlineData()
+    {
+        return reinterpret_cast<pointer>(inline_.data());
+    }
+
+    const_pointer inlineData() const
+    {
+        return reinterpret_cast<const_pointer>(inline_.data());
+    }
+
+    size_type indexOf(const_iterator iter) const
+    {
+        GASSERT((cbegin() <= iter) && (iter <= cend()));
+        return static_cast<size_type>(std::distance(cbegin(), iter));
+    }
+
+    static void destruct(iterator from, iterator to)
+    {
+        for (; from != to; ++from) {
+            from->~T();
+        }
+    }
+
+    template <typename TIter>
+    void reserveForRange(TIter from, TIter to, std::forward_iterator_tag, size_type extra = 0U)
+    {
+        reserve(extra + static_cast<size_type>(std::distance(from, to)));
+    }
+
+    template <typename TIter>
+    void reserveForRange(TIter, TIter, std::input_iterator_tag, size_type = 0U)
+    {
+    }
+
+    void reallocate(size_type newCap)
+    {
+        GASSERT(size_ <= newCap);
+        pointer newData = inlineData();
+        if (TSize < newCap) {
+            newData = static_cast<pointer>(::operator new(newCap * sizeof(T)));
+        }
+        else {
+            newCap = TSize;
+        }
+
+        if (newData == data_) {
+            return;
+        }
+
+        for (size_type idx = 0U; idx < size_; ++idx) {
+            new (newData + idx) T(std::move_if_noexcept(data_[idx]));
+            data_[idx].~T();
+        }
+
+        releaseStorage();
+        data_ = newData;
+        capacity_ = newCap;
+    }
+
+    void releaseStorage()
+    {
+        if (!isInlined()) {
+            ::operator delete(data_);
+        }
+
+        data_ = inlineData();
+        capacity_ = TSize;
+    }
+
+    void takeFrom(SmallVector&& other)
+    {
+        GASSERT(empty());
+        if (other.isInlined()) {
+            reserve(other.size());
+            for (auto& elem : other) {
+                emplace_back(std::move(elem));
+            }
+            other.clear();
+            return;
+        }
+
+        releaseStorage();
+        data_ = other.data_;
+        size_ = other.size_;
+        capacity_ = other.capacity_;
+        other.data_ = other.inlineData();
+        other.size_ = 0U;
+        other.capacity_ = TSize;
+    }
+
+    StorageType inline_;
+    pointer data_ = nullptr;
+    size_type size_ = 0U;
+    size_type capacity_ = 0U;
+};
+
+/// @brief Lexicographically compares the values in the vector.
+/// @see <a href="http://en.cppreference.com/w/cpp/container/vector/operator_cmp">Reference</a>
+/// @related SmallVector
+template <typename T, std::size_t TSize1, std::size_t TSize2>
+bool operator<(const SmallVector<T, TSize1>& v1, const SmallVector<T, TSize2>& v2)
+{
+    return std::lexicographical_compare(v1.begin(), v1.end(), v2.begin(), v2.end());
+}
+
+/// @brief Lexicographically compares the values in the vector.
+/// @see <a href="http://en.cppreference.com/w/cpp/container/vector/operator_cmp">Reference</a>
+/// @related SmallVector
+template <typename T, std::size_t TSize1, std::size_t TSize2>
+bool operator<=(const SmallVector<T, TSize1>& v1, const SmallVector<T, TSize2>& v2)
+{
+    return !(v2 < v1);
+}
+
+/// @brief Lexicographically compares the values in the vector.
+/// @see <a href="http://en.cppreference.com/w/cpp/container/vector/operator_cmp">Reference</a>
+/// @related SmallVector
+template <typename T, std::size_t TSize1, std::size_t TSize2>
+bool operator>(const SmallVector<T, TSize1>& v1, const SmallVector<T, TSize2>& v2)
+{
+    return v2 < v1;
+}
+
+/// @brief Lexicographically compares the values in the vector.
+/// @see <a href="http://en.cppreference.com/w/cpp/container/vector/operator_cmp">Reference</a>
+/// @related SmallVector
+template <typename T, std::size_t TSize1, std::size_t TSize2>
+bool operator>=(const SmallVector<T, TSize1>& v1, const SmallVector<T, TSize2>& v2)
+{
+    return !(v1 < v2);
+}
+
+/// @brief Lexicographically compares the values in the vector.
+/// @see <a href="http://en.cppreference.com/w/cpp/container/vector/operator_cmp">Reference</a>
+/// @related SmallVector
+template <typename T, std::size_t TSize1, std::size_t TSize2>
+bool operator==(const SmallVector<T, TSize1>& v1, const SmallVector<T, TSize2>& v2)
+{
+    return (v1.size() == v2.size()) &&
+           std::equal(v1.begin(), v1.end(), v2.begin());
+}
+
+/// @brief Lexicographically compares the values in the vector.
+/// @see <a href="http://en.cppreference.com/w/cpp/container/vector/operator_cmp">Reference</a>
+/// @related SmallVector
+template <typename T, std::size_t TSize1, std::size_t TSize2>
+bool operator!=(const SmallVector<T, TSize1>& v1, const SmallVector<T, TSize2>& v2)
+{
+    return !(v1 == v2);
+}
+
+}  // namespace util
+
+}  // namespace comms
+
+namespace std
+{
+
+/// @brief Specializes the std::swap algorithm.
+/// @see <a href="http://en.cppreference.com/w/cpp/container/vector/swap2">Reference</a>
+/// @related comms::util::SmallVector
+template <typename T, std::size_t TSize>
+void swap(comms::util::SmallVector<T, TSize>& v1, comms::util::SmallVector<T, TSize>& v2)
+{
+    v1.swap(v2);
+}
+
+}
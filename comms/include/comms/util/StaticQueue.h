@@ -1726,7 +1726,7 @@ protected:
 template <typename T>
 class StaticQueueBaseOptimised : public StaticQueueBase<T>
 {
-    usign Base = StaticQueueBase<T>;
+    using Base = StaticQueueBase<T>;
 protected:
 
     using StorageTypePtr = typename Base::StorageTypePtr;
@@ -1802,7 +1802,7 @@ class StaticQueueBaseOptimised<std::int64_t> : public CastWrapperQueueBase<std::
     using Base = CastWrapperQueueBase<std::int64_t, std::uint64_t>;
 protected:
 
-    using StorageTypePtr = stypename Base::StorageTypePtr;
+    using StorageTypePtr = typename Base::StorageTypePtr;
 
     StaticQueueBaseOptimised(StorageTypePtr data, std::size_t capacity)
         : Base(data, capacity)
@@ -1820,7 +1820,7 @@ class StaticQueueBaseOptimised<T*> : public CastWrapperQueueBase<T*, typename co
     using Base = CastWrapperQueueBase<T*, typename comms::util::SizeToType<sizeof(T*)>::Type>;
 protected:
 
-    using Base = typename Base::StorageTypePtr;
+    using StorageTypePtr = typename Base::StorageTypePtr;
 
     StaticQueueBaseOptimised(StorageTypePtr data, std::size_t capacity)
         : Base(data, capacity)
@@ -0,0 +1,389 @@
+//
+// Copyright 2016 (C). Alex Robenko. All rights reserved.
+//
+
+// This library is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file comms/util/StaticSpscQueue.h
+/// This file contains the definition and implementation of the lock-free
+/// single producer / single consumer static queue.
+
+#pragma once
+
+#include <cstddef>
+#include <array>
+#include <atomic>
+#include <utility>
+#include <type_traits>
+#include <iterator>
+#include <algorithm>
+
+#include "comms/Assert.h"
+
+namespace comms
+{
+
+namespace util
+{
+
+/// @brief Lock-free single producer / single consumer queue with static
+///        storage.
+/// @details It is a companion of comms::util::StaticQueue, which can be
+///          used to pass elements between exactly two threads (for example
+///          interrupt or I/O thread and processing thread) without any
+///          locking. Just like comms::util::StaticQueue it doesn't use any
+///          dynamic memory allocation or exceptions.
+///
+///          All the "producer" functions (pushBack(), emplaceBack(),
+///          pushBackMultiple()) can be invoked only by the
+///          single producer thread, while all the "consumer" functions
+///          (front(), popFront(), popFrontMultiple(), frontArray())
+///          can be invoked only by the single consumer thread. The head
+///          and tail indices reside on separate cache lines to avoid
+///          false sharing between the producer and consumer.
+/// @tparam T Type of the stored element.
+/// @tparam TSize Size of the queue in number - maximum number of stored
+///         elements.
+/// @headerfile comms/util/StaticSpscQueue.h
+template <typename T, std::size_t TSize>
+class StaticSpscQueue
+{
+    static_assert(0U < TSize, "The queue capacity must not be 0");
+
+    using StorageType =
+        typename std::aligned_storage<
+            sizeof(T),
+            std::alignment_of<T>::value
+        >::type;
+
+public:
+    /// @brief Type of the stored elements.
+    using ValueType = T;
+
+    /// @brief Same as ValueType
+    using value_type = ValueType;
+
+    /// @brief Pointer type to the stored elements.
+    using Pointer = ValueType*;
+
+    /// @brief Const pointer type to the stored elements.
+    using ConstPointer = const ValueType*;
+
+    /// @brief Const linearised iterator type
+    using ConstLinearisedIterator = ConstPointer;
+
+    /// @brief Const linearised iterator range type - std::pair of
+    ///        (first, one-past-last) iterators.
+    using ConstLinearisedIteratorRange =
+        std::pair<ConstLinearisedIterator, ConstLinearisedIterator>;
+
+    /// @brief Assumed size of the cache line.
+    static const std::size_t CacheLineSize = 64U;
+
+    /// @brief Default constructor.
+    /// @details Creates empty queue.
+    StaticSpscQueue() = default;
+
+    /// @brief Copy is not allowed
+    StaticSpscQueue(const StaticSpscQueue&) = delete;
+
+    /// @brief Destructor
+    /// @details All the remaining elements are destructed.
+    /// @note Thread safety: Unsafe, neither producer nor consumer may use
+    ///       the queue during its destruction.
+    ~StaticSpscQueue()
+    {
+        clear();
+    }
+
+    /// @brief Copy assignment is not allowed
+    StaticSpscQueue& operator=(const StaticSpscQueue&) = delete;
+
+    /// @brief Returns capacity of the queue
+    static constexpr std::size_t capacity()
+    {
+        return TSize;
+    }
+
+    /// @brief Returns current size of the queue.
+    /// @details When invoked by a thread which is neither producer nor
+    ///          consumer, the returned value is a snapshot which may already
+    ///          be outdated.
+    /// @note Thread safety: Safe
+    /// @note Exception guarantee: No throw.
+    std::size_t size() const
+    {
+        auto tail = producer_.tail_.load(std::memory_order_acquire);
+        auto head = consumer_.head_.load(std::memory_order_acquire);
+        return distance(head, tail);
+    }
+
+    /// @brief Returns whether the queue is empty.
+    /// @note Thread safety: Safe
+    /// @note Exception guarantee: No throw.
+    bool empty() const
+    {
+        return size() == 0U;
+    }
+
+    /// @brief Returns whether the queue is full.
+    /// @note Thread safety: Safe
+    /// @note Exception guarantee: No throw.
+    bool full() const
+    {
+        return size() == capacity();
+    }
+
+    /// @brief Destruct all the elements currently residing in the queue.
+    /// @note Thread safety: Consumer only.
+    /// @note Exception guarantee: No throw in case the destructor of the
+    ///       stored elements doesn't throw. Basic guarantee otherwise.
+    void clear()
+    {
+        while (popFront()) {}
+    }
+
+    /// @brief Add new element to the end of the queue.
+    /// @details Uses copy/move constructor to copy/move the provided element.
+    /// @param[in] value Value to insert
+    /// @return true in case the element was added, false if the queue is full.
+    /// @note Thread safety: Producer only.
+    /// @note Exception guarantee: No throw in case the copy constructor
+    ///       of the stored elements doesn't throw. Basic guarantee otherwise.
+    template <typename U>
+    bool pushBack(U&& value)
+    {
+        return emplaceBack(std::forward<U>(value));
+    }
+
+    /// @brief Construct new element at the end of the queue.
+    /// @details Passes all the provided arguments to the constructor of the
+    ///          element.
+    /// @param[in] args Parameters to the constructor of the element
+    /// @return true in case the element was added, false if the queue is full.
+    /// @note Thread safety: Producer only.
+    /// @note Exception guarantee: No throw in case the constructor
+    ///       of the stored elements doesn't throw. Basic guarantee otherwise.
+    template <typename... TArgs>
+    bool emplaceBack(TArgs&&... args)
+    {
+        auto tail = producer_.tail_.load(std::memory_order_relaxed);
+        if (producerSpace(tail) == 0U) {
+            return false;
+        }
+
+        new (elemPtr(tail)) ValueType(std::forward<TArgs>(args)...);
+        producer_.tail_.store(next(tail), std::memory_order_release);
+        return true;
+    }
+
+    /// @brief Add multiple elements to the end of the queue.
+    /// @details Copies as many elements as the queue can accommodate.
+    ///          The newly added elements become visible to the consumer
+    ///          all at once.
+    /// @param[in] from Input iterator to the first element to add.
+    /// @param[in] count Number of elements available from the iterator.
+    /// @return Number of elements actually added.
+    /// @note Thread safety: Producer only.
+    /// @note Exception guarantee: No throw in case the copy constructor
+    ///       of the stored elements doesn't throw. Basic guarantee otherwise.
+    template <typename TIter>
+    std::size_t pushBackMultiple(TIter from, std::size_t count)
+    {
+        auto tail = producer_.tail_.load(std::memory_order_relaxed);
+        auto toAdd = std::min(count, producerSpace(tail, count));
+        if (toAdd == 0U) {
+            return 0U;
+        }
+
+        auto pos = tail;
+        for (auto remaining = toAdd; 0U < remaining; --remaining) {
+            new (elemPtr(pos)) ValueType(*from);
+            ++from;
+            pos = next(pos);
+        }
+
+        producer_.tail_.store(pos, std::memory_order_release);
+        return toAdd;
+    }
+
+    /// @brief Provide access to the front element.
+    /// @return Pointer to the front element or nullptr if the queue is empty.
+    /// @note Thread safety: Consumer only.
+    /// @note Exception guarantee: No throw.
+    Pointer front()
+    {
+        auto head = consumer_.head_.load(std::memory_order_relaxed);
+        if (consumerAvailable(head) == 0U) {
+            return nullptr;
+        }
+        return elemPtr(head);
+    }
+
+    /// @brief Pop the element from the front of the queue.
+    /// @details The destructor of the popped element is called.
+    /// @return true in case the element was popped, false if the queue is empty.
+    /// @note Thread safety: Consumer only.
+    /// @note Exception guarantee: No throw in case the destructor of the
+    ///       popped element doesn't throw. Basic guarantee otherwise.
+    bool popFront()
+    {
+        return popFrontCount(1U) != 0U;
+    }
+
+    /// @brief Move the front element out and pop it from the queue.
+    /// @param[out] value Element to assign the popped value to.
+    /// @return true in case the element was popped, false if the queue is empty.
+    /// @note Thread safety: Consumer only.
+    /// @note Exception guarantee: No throw in case the move assignment and
+    ///       destructor of the stored elements don't throw. Basic guarantee
+    ///       otherwise.
+    bool popFront(ValueType& value)
+    {
+        return popFrontMultiple(&value, 1U) != 0U;
+    }
+
+    /// @brief Pop multiple elements from the front of the queue.
+    /// @details The destructors of the popped elements are called.
+    /// @param[in] count Maximal number of elements to pop.
+    /// @return Number of elements actually popped.
+    /// @note Thread safety: Consumer only.
+    /// @note Exception guarantee: No throw in case the destructor of the
+    ///       popped elements doesn't throw. Basic guarantee otherwise.
+    std::size_t popFrontCount(std::size_t count)
+    {
+        auto head = consumer_.head_.load(std::memory_order_relaxed);
+        auto toPop = std::min(count, consumerAvailable(head, count));
+        auto pos = head;
+        for (auto remaining = toPop; 0U < remaining; --remaining) {
+            elemPtr(pos)->~ValueType();
+            pos = next(pos);
+        }
+
+        if (0U < toPop) {
+            consumer_.head_.store(pos, std::memory_order_release);
+        }
+        return toPop;
+    }
+
+    /// @brief Move multiple elements out of the queue and pop them.
+    /// @details The popped elements are released back to the producer
+    ///          all at once.
+    /// @param[in] to Output iterator to assign the popped elements to.
+    /// @param[in] count Maximal number of elements to pop.
+    /// @return Number of elements actually popped.
+    /// @note Thread safety: Consumer only.
+    /// @note Exception guarantee: No throw in case the move assignment and
+    ///       destructor of the stored elements don't throw. Basic guarantee
+    ///       otherwise.
+    template <typename TIter>
+    std::size_t popFrontMultiple(TIter to, std::size_t count)
+    {
+        auto head = consumer_.head_.load(std::memory_order_relaxed);
+        auto toPop = std::min(count, consumerAvailable(head, count));
+        auto pos = head;
+        for (auto remaining = toPop; 0U < remaining; --remaining) {
+            auto* elem = elemPtr(pos);
+            *to = std::move(*elem);
+            ++to;
+            elem->~ValueType();
+            pos = next(pos);
+        }
+
+        if (0U < toPop) {
+            consumer_.head_.store(pos, std::memory_order_release);
+        }
+        return toPop;
+    }
+
+    /// @brief Get the continuous array of elements available for consumption.
+    /// @details Allows zero-copy processing of the queued elements. When the
+    ///          available elements wrap around the end of the internal
+    ///          buffer, only the first continuous part is reported, the rest
+    ///          becomes available after the reported elements are
+    ///          popped using popFrontCount().
+    /// @return Closed-open range (std::pair) of the iterators. In case the
+    ///         queue is empty, both iterators are equal.
+    /// @note Thread safety: Consumer only.
+    /// @note Exception guarantee: No throw.
+    ConstLinearisedIteratorRange frontArray()
+    {
+        auto head = consumer_.head_.load(std::memory_order_relaxed);
+        auto available = consumerAvailable(head, TSize);
+        auto continuous = std::min(available, BufSize - head);
+        ConstPointer first = elemPtr(head);
+        return ConstLinearisedIteratorRange(first, first + continuous);
+    }
+
+private:
+    static const std::size_t BufSize = TSize + 1;
+
+    static constexpr std::size_t next(std::size_t idx)
+    {
+        return (idx + 1) == BufSize ? 0U : idx + 1;
+    }
+
+    static constexpr std::size_t distance(std::size_t from, std::size_t to)
+    {
+        return from <= to ? to - from : (BufSize - from) + to;
+    }
+
+    Pointer elemPtr(std::size_t idx)
+    {
+        GASSERT(idx < BufSize);
+        return reinterpret_cast<Pointer>(&array_[idx]);
+    }
+
+    std::size_t producerSpace(std::size_t tail, std::size_t required = 1U)
+    {
+        auto space = TSize - distance(producer_.cachedHead_, tail);
+        if (space < required) {
+            producer_.cachedHead_ = consumer_.head_.load(std::memory_order_acquire);
+            space = TSize - distance(producer_.cachedHead_, tail);
+        }
+        return space;
+    }
+
+    std::size_t consumerAvailable(std::size_t head, std::size_t required = 1U)
+    {
+        auto available = distance(head, consumer_.cachedTail_);
+        if (available < required) {
+            consumer_.cachedTail_ = producer_.tail_.load(std::memory_order_acquire);
+            available = distance(head, consumer_.cachedTail_);
+        }
+        return available;
+    }
+
+    struct alignas(CacheLineSize) ProducerState
+    {
+        std::atomic<std::size_t> tail_{0U};
+        std::size_t cachedHead_ = 0U;
+    };
+
+    struct alignas(CacheLineSize) ConsumerState
+    {
+        std::atomic<std::size_t> head_{0U};
+        std::size_t cachedTail_ = 0U;
+    };
+
+    using ArrayType = std::array<StorageType, BufSize>;
+
+    ProducerState producer_;
+    ConsumerState consumer_;
+    alignas(CacheLineSize) ArrayType array_;
+};
+
+}  // namespace util
+
+}  // namespace comms
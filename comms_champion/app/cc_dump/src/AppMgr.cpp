@@ -24,6 +24,7 @@
 CC_DISABLE_WARNINGS()
 #include <QtCore/QDir>
 #include <QtCore/QCoreApplication>
+#include <QtCore/QFile>
 CC_ENABLE_WARNINGS()
 
 #include "comms_champion/property/message.h"
@@ -78,6 +79,18 @@ AppMgr::AppMgr()
             QTimer::singleShot(m_config.m_lastWait, qApp, SLOT(quit()));
         });
 
+    m_msgMgr.setSocketDisconnectReportCallbackFunc(
+        [this]()
+        {
+            std::cerr << "INFO: Socket disconnected" << std::endl;
+            if (!m_config.m_quitOnDisconnect) {
+                return;
+            }
+
+            flushOutput();
+            QTimer::singleShot(0, qApp, SLOT(quit()));
+        });
+
     connect(
         &m_flushTimer, SIGNAL(timeout()),
         this, SLOT(flushOutput()));
@@ -108,6 +121,12 @@ bool AppMgr::start(const Config& config)
         return false;
     }
 
+    auto& pluginStats = m_pluginMgr.getStats();
+    std::cerr << "INFO: Found " << pluginStats.m_available << " plugins (" <<
+        pluginStats.m_cached << " indexed) in " << pluginStats.m_scanMs <<
+        " ms, loaded " << pluginStats.m_loaded << " in " <<
+        pluginStats.m_loadMs << " ms" << std::endl;
+
     m_config = config;
     if (!m_config.m_quiet) {
         m_csvDump.reset(new CsvDumpMessageHandler(std::cout, Sep));
@@ -118,10 +137,31 @@ bool AppMgr::start(const Config& config)
     }
 
     if (!m_config.m_inMsgsFile.isEmpty()) {
-        m_record.reset(new RecordMessageHandler(m_config.m_inMsgsFile));
+        m_record.reset(
+            new RecordMessageHandler(
+                m_config.m_inMsgsFile,
+                m_config.m_recordCommitInterval));
+    }
+
+    if (!m_config.m_columnarFile.isEmpty()) {
+        m_columnar.reset(new ColumnarDumpMessageHandler(m_config.m_columnarFile));
+        if (!m_columnar->isOpen()) {
+            std::cerr << "ERROR: Failed to open columnar output file \"" <<
+                m_config.m_columnarFile.toStdString() << "\"" << std::endl;
+            return false;
+        }
+    }
+
+    if (!m_config.m_captureFile.isEmpty()) {
+        return parseCapture();
+    }
+
+    if (0U < m_config.m_loadDuration) {
+        return startLoad();
     }
 
     m_msgMgr.setRecvEnabled(true);
+    m_msgMgr.setLatencyStatsEnabled(m_config.m_latencyStats);
     m_msgMgr.start();
 
     auto socket = m_msgMgr.getSocket();
@@ -164,10 +204,40 @@ void AppMgr::flushOutput()
 
     if (m_record) {
         m_record->flush();
+        reportRecordStats();
+    }
+
+    if (m_columnar) {
+        m_columnar->flush();
+    }
+
+    if (m_config.m_latencyStats) {
+        reportLatencyStats();
     }
 }
 
 bool AppMgr::applyPlugins(const ListOfPluginInfos& plugins)
+{
+    m_appliedPlugins.clear();
+    for (auto& info : plugins) {
+        cc::Plugin* plugin = m_pluginMgr.loadPlugin(*info);
+        if (plugin == nullptr) {
+            assert(!"Failed to load plugin");
+            continue;
+        }
+
+        m_appliedPlugins.push_back(plugin);
+    }
+
+    if (!applyPluginsTo(m_msgMgr)) {
+        return false;
+    }
+
+    m_pluginMgr.setAppliedPlugins(plugins);
+    return true;
+}
+
+bool AppMgr::applyPluginsTo(cc::MsgMgr& msgMgr)
 {
     typedef cc::Plugin::ListOfFilters ListOfFilters;
 
@@ -179,13 +249,8 @@ bool AppMgr::applyPlugins(const ListOfPluginInfos& plugins)
     };
 
     auto applyInfo = ApplyInfo();
-    for (auto& info : plugins) {
-        cc::Plugin* plugin = m_pluginMgr.loadPlugin(*info);
-        if (plugin == nullptr) {
-            assert(!"Failed to load plugin");
-            continue;
-        }
-
+    for (auto* plugin : m_appliedPlugins) {
+        assert(plugin != nullptr);
         if (!applyInfo.m_socket) {
             applyInfo.m_socket = plugin->createSocket();
         }
@@ -194,6 +259,9 @@ bool AppMgr::applyPlugins(const ListOfPluginInfos& plugins)
 
         if (!applyInfo.m_protocol) {
             applyInfo.m_protocol = plugin->createProtocol();
+            if (applyInfo.m_protocol) {
+                m_protocolPlugin = plugin;
+            }
         }
     }
 
@@ -207,18 +275,181 @@ bool AppMgr::applyPlugins(const ListOfPluginInfos& plugins)
         return false;
     }
 
-    m_msgMgr.setSocket(std::move(applyInfo.m_socket));
+    msgMgr.setSocket(std::move(applyInfo.m_socket));
 
     for (auto& filter : applyInfo.m_filters) {
-        m_msgMgr.addFilter(std::move(filter));
+        msgMgr.addFilter(std::move(filter));
     }
 
-    m_msgMgr.setProtocol(std::move(applyInfo.m_protocol));
+    msgMgr.setProtocol(std::move(applyInfo.m_protocol));
+    return true;
+}
 
-    m_pluginMgr.setAppliedPlugins(plugins);
+bool AppMgr::startLoad()
+{
+    if (m_config.m_outMsgsFile.isEmpty()) {
+        std::cerr << "ERROR: Messages mix for load generation wasn't provided, "
+                     "please use \"-s\" option." << std::endl;
+        return false;
+    }
+
+    auto protocol = m_msgMgr.getProtocol();
+    assert(protocol);
+    auto msgs =
+        m_msgFileMgr.load(
+            cc::MsgFileMgr::Type::Send,
+            m_config.m_outMsgsFile,
+            *protocol);
+
+    LoadGenerator::Config loadConfig;
+    loadConfig.m_durationMs = m_config.m_loadDuration;
+    loadConfig.m_rate = m_config.m_loadRate;
+    loadConfig.m_connections = m_config.m_loadConnections;
+
+    m_loadGen.reset(
+        new LoadGenerator(
+            loadConfig,
+            [this](cc::MsgMgr& msgMgr) -> bool
+            {
+                return applyPluginsTo(msgMgr);
+            }));
+
+    m_loadGen->setFinishedCallbackFunc(
+        [this]()
+        {
+            if (m_config.m_lastWait == 0U) {
+                return;
+            }
+
+            QTimer::singleShot(m_config.m_lastWait, qApp, SLOT(quit()));
+        });
+
+    return m_loadGen->start(msgs);
+}
+
+bool AppMgr::parseCapture()
+{
+    QFile file(m_config.m_captureFile);
+    if (!file.open(QIODevice::ReadOnly)) {
+        std::cerr << "ERROR: Failed to open capture file \"" <<
+            m_config.m_captureFile.toStdString() << "\"" << std::endl;
+        return false;
+    }
+
+    auto fileSize = file.size();
+    if (fileSize <= 0) {
+        std::cerr << "WARNING: Capture file is empty" << std::endl;
+        QTimer::singleShot(0, qApp, SLOT(quit()));
+        return true;
+    }
+
+    auto* data = file.map(0, fileSize);
+    if (data == nullptr) {
+        std::cerr << "ERROR: Failed to map capture file to memory" << std::endl;
+        return false;
+    }
+
+    assert(m_protocolPlugin != nullptr);
+    cc::Plugin* plugin = m_protocolPlugin;
+    cc::ParallelParser parser;
+    parser.setProtocolCreateFunc(
+        [plugin]() -> cc::ProtocolPtr
+        {
+            return plugin->createProtocol();
+        });
+
+    if (m_config.m_parseBenchmark) {
+        benchmarkParse(parser, data, static_cast<std::size_t>(fileSize));
+        file.unmap(data);
+        QTimer::singleShot(0, qApp, SLOT(quit()));
+        return true;
+    }
+
+    if (!m_config.m_parseThreads.empty()) {
+        if (1U < m_config.m_parseThreads.size()) {
+            std::cerr << "WARNING: Multiple threads counts are used only with \"--parse-benchmark\", " <<
+                "parsing with the first one" << std::endl;
+        }
+        parser.setThreadsCount(m_config.m_parseThreads.front());
+    }
+
+    parser.setDispatchFunc(
+        [this](cc::ParallelParser::MessagesList&& msgs)
+        {
+            for (auto& msg : msgs) {
+                assert(msg);
+                cc::property::message::Type().setTo(cc::Message::Type::Received, *msg);
+                dispatchMsg(*msg);
+            }
+        });
+
+    parser.parse(data, static_cast<std::size_t>(fileSize));
+    file.unmap(data);
+
+    flushOutput();
+    QTimer::singleShot(0, qApp, SLOT(quit()));
     return true;
 }
 
+void AppMgr::benchmarkParse(
+    cc::ParallelParser& parser,
+    const std::uint8_t* data,
+    std::size_t size)
+{
+    auto threadsList = m_config.m_parseThreads;
+    if (threadsList.empty()) {
+        threadsList.push_back(0U);
+    }
+
+    for (auto threads : threadsList) {
+        parser.setThreadsCount(threads);
+        parser.parse(data, size);
+        auto& stats = parser.lastStats();
+        std::cerr << "INFO: Parsed " << stats.m_bytes << " bytes into " <<
+            stats.m_messages << " messages using " << stats.m_threads <<
+            " thread(s) in " << stats.m_elapsedMs << " ms (" <<
+            stats.throughput() << " MB/s)" << std::endl;
+    }
+}
+
+void AppMgr::reportRecordStats()
+{
+    assert(m_record);
+    auto stats = m_record->getStats();
+    if ((stats.m_bytesPerSec == 0U) && (stats.m_queued == 0U) && (stats.m_dropped == 0U)) {
+        return;
+    }
+
+    std::cerr << "INFO: Recording queue depth " << stats.m_queued <<
+        ", written " << stats.m_bytes << " bytes (" <<
+        stats.m_bytesPerSec << " bytes/s)";
+    if (stats.m_dropped != 0U) {
+        std::cerr << ", dropped " << stats.m_dropped << " messages";
+    }
+    std::cerr << std::endl;
+}
+
+void AppMgr::reportLatencyStats()
+{
+    auto stats = m_msgMgr.getLatencyStats();
+    m_msgMgr.resetLatencyStats();
+    if (stats[cc::MsgMgr::LatencyStage_Reported].count() == 0U) {
+        return;
+    }
+
+    std::cerr << "INFO: Latency (us, p50/p99/p99.9/max)";
+    for (unsigned idx = 0U; idx < stats.size(); ++idx) {
+        auto& hist = stats[idx];
+        std::cerr << (idx == 0U ? ": " : ", ") <<
+            cc::MsgMgr::latencyStageName(static_cast<cc::MsgMgr::LatencyStage>(idx)) << ' ' <<
+            hist.valueAtPercentile(50.0) << '/' <<
+            hist.valueAtPercentile(99.0) << '/' <<
+            hist.valueAtPercentile(99.9) << '/' <<
+            hist.max();
+    }
+    std::cerr << " over " << stats[cc::MsgMgr::LatencyStage_Reported].count() << " msgs" << std::endl;
+}
+
 void AppMgr::dispatchMsg(comms_champion::Message& msg)
 {
     if (m_csvDump) {
@@ -228,6 +459,10 @@ void AppMgr::dispatchMsg(comms_champion::Message& msg)
     if (m_record) {
         msg.dispatch(*m_record);
     }
+
+    if (m_columnar) {
+        msg.dispatch(*m_columnar);
+    }
 }
 
 } /* namespace comms_dump */
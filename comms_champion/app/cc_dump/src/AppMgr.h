@@ -18,6 +18,9 @@
 #pragma once
 
 #include <memory>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
 
 #include "comms/CompileControl.h"
 
@@ -31,9 +34,12 @@ CC_ENABLE_WARNINGS()
 #include "comms_champion/MsgMgr.h"
 #include "comms_champion/MsgFileMgr.h"
 #include "comms_champion/MsgSendMgr.h"
+#include "comms_champion/ParallelParser.h"
 
 #include "CsvDumpMessageHandler.h"
+#include "ColumnarDumpMessageHandler.h"
 #include "RecordMessageHandler.h"
+#include "LoadGenerator.h"
 
 namespace comms_dump
 {
@@ -51,6 +57,16 @@ public:
         unsigned m_lastWait = 0U;
         bool m_recordOutgoing = false;
         bool m_quiet = false;
+        bool m_quitOnDisconnect = false;
+        QString m_captureFile;
+        QString m_columnarFile;
+        unsigned m_recordCommitInterval = 250U; // ms, must not be 0
+        unsigned m_loadDuration = 0U;
+        unsigned m_loadRate = 0U;
+        unsigned m_loadConnections = 1U;
+        bool m_latencyStats = false;
+        std::vector<unsigned> m_parseThreads;
+        bool m_parseBenchmark = false;
     };
 
     AppMgr();
@@ -65,17 +81,29 @@ private:
     typedef comms_champion::PluginMgr::ListOfPluginInfos ListOfPluginInfos;
     typedef std::unique_ptr<CsvDumpMessageHandler> CsvDumpMessageHandlerPtr;
     typedef std::unique_ptr<RecordMessageHandler> RecordMessageHandlerPtr;
+    typedef std::unique_ptr<ColumnarDumpMessageHandler> ColumnarDumpMessageHandlerPtr;
+    typedef std::unique_ptr<LoadGenerator> LoadGeneratorPtr;
 
     bool applyPlugins(const ListOfPluginInfos& plugins);
+    bool applyPluginsTo(comms_champion::MsgMgr& msgMgr);
+    bool startLoad();
+    bool parseCapture();
+    void benchmarkParse(comms_champion::ParallelParser& parser, const std::uint8_t* data, std::size_t size);
     void dispatchMsg(comms_champion::Message& msg);
+    void reportRecordStats();
+    void reportLatencyStats();
 
     comms_champion::PluginMgr m_pluginMgr;
+    comms_champion::Plugin* m_protocolPlugin = nullptr;
+    std::vector<comms_champion::Plugin*> m_appliedPlugins;
     comms_champion::MsgMgr m_msgMgr;
     comms_champion::MsgFileMgr m_msgFileMgr;
     comms_champion::MsgSendMgr m_msgSendMgr;
     Config m_config;
     CsvDumpMessageHandlerPtr m_csvDump;
     RecordMessageHandlerPtr m_record;
+    ColumnarDumpMessageHandlerPtr m_columnar;
+    LoadGeneratorPtr m_loadGen;
     QTimer m_flushTimer;
 };
 
@@ -0,0 +1,514 @@
+//
+// Copyright 2017 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "ColumnarDumpMessageHandler.h"
+
+#include <cassert>
+#include <cstring>
+#include <typeinfo>
+
+#include "comms_champion/field_wrapper/FieldWrapperHandler.h"
+#include "comms_champion/property/message.h"
+#include "comms_champion/property/field.h"
+
+namespace cc = comms_champion;
+
+namespace comms_dump
+{
+
+namespace
+{
+
+typedef ColumnarDumpMessageHandler::Column Column;
+typedef ColumnarDumpMessageHandler::ColumnType ColumnType;
+typedef std::vector<Column> ColumnsList;
+typedef std::vector<std::uint8_t> DataBuf;
+
+const char FileMagic[] = "CCCOLS01";
+const char SchemaRecord = 'S';
+const char BatchRecord = 'B';
+const std::uint32_t RowsPerBatch = 4096U;
+
+void appendLe(DataBuf& buf, std::uint64_t value, std::size_t len)
+{
+    for (auto idx = 0U; idx < len; ++idx) {
+        buf.push_back(static_cast<std::uint8_t>(value & 0xff));
+        value >>= 8;
+    }
+}
+
+void appendStr(DataBuf& buf, const char* str, std::size_t len)
+{
+    appendLe(buf, len, sizeof(std::uint32_t));
+    buf.insert(buf.end(), str, str + len);
+}
+
+bool isFixedWidth(ColumnType type)
+{
+    return (type == ColumnType::Int64) ||
+           (type == ColumnType::UInt64) ||
+           (type == ColumnType::Float64);
+}
+
+void resetColumn(Column& col)
+{
+    col.m_validity.clear();
+    col.m_data.clear();
+    col.m_offsets.clear();
+    if (!isFixedWidth(col.m_type)) {
+        col.m_offsets.push_back(0U);
+    }
+}
+
+void addValidity(Column& col, std::uint32_t row, bool valid)
+{
+    if ((row % 8U) == 0U) {
+        col.m_validity.push_back(0U);
+    }
+
+    assert(!col.m_validity.empty());
+    if (valid) {
+        col.m_validity.back() |= static_cast<std::uint8_t>(1U << (row % 8U));
+    }
+}
+
+void appendFixed(Column& col, std::uint32_t row, std::uint64_t value, bool valid)
+{
+    assert(isFixedWidth(col.m_type));
+    addValidity(col, row, valid);
+    appendLe(col.m_data, valid ? value : 0U, sizeof(value));
+}
+
+void appendVar(Column& col, std::uint32_t row, const char* data, std::size_t len, bool valid)
+{
+    assert(!isFixedWidth(col.m_type));
+    addValidity(col, row, valid);
+    if (valid) {
+        col.m_data.insert(col.m_data.end(), data, data + len);
+    }
+    col.m_offsets.push_back(static_cast<std::uint32_t>(col.m_data.size()));
+}
+
+class LayoutBuilder : public cc::field_wrapper::FieldWrapperHandler
+{
+public:
+    LayoutBuilder(ColumnsList& columns, const QString& name, const QVariantMap& props)
+      : m_columns(columns),
+        m_name(name),
+        m_props(props)
+    {
+    }
+
+    virtual void handle(cc::field_wrapper::IntValueWrapper& wrapper) override
+    {
+        static_cast<void>(wrapper);
+        addColumn(ColumnType::Int64);
+    }
+
+    virtual void handle(cc::field_wrapper::UnsignedLongValueWrapper& wrapper) override
+    {
+        static_cast<void>(wrapper);
+        addColumn(ColumnType::UInt64);
+    }
+
+    virtual void handle(cc::field_wrapper::BitmaskValueWrapper& wrapper) override
+    {
+        static_cast<void>(wrapper);
+        addColumn(ColumnType::UInt64);
+    }
+
+    virtual void handle(cc::field_wrapper::EnumValueWrapper& wrapper) override
+    {
+        static_cast<void>(wrapper);
+        addColumn(ColumnType::Int64);
+    }
+
+    virtual void handle(cc::field_wrapper::StringWrapper& wrapper) override
+    {
+        static_cast<void>(wrapper);
+        addColumn(ColumnType::String);
+    }
+
+    virtual void handle(cc::field_wrapper::BitfieldWrapper& wrapper) override
+    {
+        addMembers(wrapper.getMembers(), cc::property::field::Bitfield(m_props).members());
+    }
+
+    virtual void handle(cc::field_wrapper::OptionalWrapper& wrapper) override
+    {
+        auto props = m_props;
+        m_props = cc::property::field::Optional(props).field();
+        wrapper.getFieldWrapper().dispatch(*this);
+        m_props = std::move(props);
+    }
+
+    virtual void handle(cc::field_wrapper::BundleWrapper& wrapper) override
+    {
+        addMembers(wrapper.getMembers(), cc::property::field::Bundle(m_props).members());
+    }
+
+    virtual void handle(cc::field_wrapper::FloatValueWrapper& wrapper) override
+    {
+        static_cast<void>(wrapper);
+        addColumn(ColumnType::Float64);
+    }
+
+    virtual void handle(cc::field_wrapper::FieldWrapper& wrapper) override
+    {
+        static_cast<void>(wrapper);
+        addColumn(ColumnType::Bytes);
+    }
+
+private:
+    typedef QList<QVariantMap> MembersPropsList;
+
+    template <typename TMembers>
+    void addMembers(TMembers& members, const MembersPropsList& membersProps)
+    {
+        auto name = m_name;
+        auto props = m_props;
+        for (auto idx = 0U; idx < members.size(); ++idx) {
+            m_props = membersProps.value(static_cast<int>(idx));
+            auto memName = cc::property::field::Common(m_props).name();
+            if (memName.isEmpty()) {
+                memName = QString::number(idx);
+            }
+
+            m_name = name + '.' + memName;
+            members[idx]->dispatch(*this);
+        }
+        m_name = std::move(name);
+        m_props = std::move(props);
+    }
+
+    void addColumn(ColumnType type)
+    {
+        Column col;
+        col.m_type = type;
+        col.m_name = m_name.toStdString();
+        resetColumn(col);
+        m_columns.push_back(std::move(col));
+    }
+
+    ColumnsList& m_columns;
+    QString m_name;
+    QVariantMap m_props;
+};
+
+class RowWriter : public cc::field_wrapper::FieldWrapperHandler
+{
+public:
+    RowWriter(ColumnsList& columns, unsigned& colIdx, std::uint32_t row)
+      : m_columns(columns),
+        m_colIdx(colIdx),
+        m_row(row)
+    {
+    }
+
+    virtual void handle(cc::field_wrapper::IntValueWrapper& wrapper) override
+    {
+        writeFixed(static_cast<std::uint64_t>(wrapper.getValue()));
+    }
+
+    virtual void handle(cc::field_wrapper::UnsignedLongValueWrapper& wrapper) override
+    {
+        writeFixed(wrapper.getValue());
+    }
+
+    virtual void handle(cc::field_wrapper::BitmaskValueWrapper& wrapper) override
+    {
+        writeFixed(wrapper.getValue());
+    }
+
+    virtual void handle(cc::field_wrapper::EnumValueWrapper& wrapper) override
+    {
+        writeFixed(static_cast<std::uint64_t>(wrapper.getValue()));
+    }
+
+    virtual void handle(cc::field_wrapper::StringWrapper& wrapper) override
+    {
+        auto* col = nextColumn();
+        if (col == nullptr) {
+            return;
+        }
+
+        auto utf8 = wrapper.getValue().toUtf8();
+        appendVar(*col, m_row, utf8.constData(), static_cast<std::size_t>(utf8.size()), !m_null);
+    }
+
+    virtual void handle(cc::field_wrapper::BitfieldWrapper& wrapper) override
+    {
+        for (auto& mem : wrapper.getMembers()) {
+            mem->dispatch(*this);
+        }
+    }
+
+    virtual void handle(cc::field_wrapper::OptionalWrapper& wrapper) override
+    {
+        auto wasNull = m_null;
+        if (wrapper.getMode() != comms::field::OptionalMode::Exists) {
+            m_null = true;
+        }
+
+        wrapper.getFieldWrapper().dispatch(*this);
+        m_null = wasNull;
+    }
+
+    virtual void handle(cc::field_wrapper::BundleWrapper& wrapper) override
+    {
+        for (auto& mem : wrapper.getMembers()) {
+            mem->dispatch(*this);
+        }
+    }
+
+    virtual void handle(cc::field_wrapper::FloatValueWrapper& wrapper) override
+    {
+        double value = wrapper.getValue();
+        std::uint64_t bits = 0U;
+        static_assert(sizeof(bits) == sizeof(value), "Unexpected double size");
+        std::memcpy(&bits, &value, sizeof(bits));
+        writeFixed(bits);
+    }
+
+    virtual void handle(cc::field_wrapper::FieldWrapper& wrapper) override
+    {
+        auto* col = nextColumn();
+        if (col == nullptr) {
+            return;
+        }
+
+        auto seq = wrapper.getSerialisedValue();
+        appendVar(
+            *col,
+            m_row,
+            reinterpret_cast<const char*>(seq.data()),
+            seq.size(),
+            !m_null);
+    }
+
+private:
+    Column* nextColumn()
+    {
+        if (m_columns.size() <= m_colIdx) {
+            assert(!"Layout of the message has changed");
+            return nullptr;
+        }
+
+        auto* col = &m_columns[m_colIdx];
+        ++m_colIdx;
+        return col;
+    }
+
+    void writeFixed(std::uint64_t value)
+    {
+        auto* col = nextColumn();
+        if (col == nullptr) {
+            return;
+        }
+
+        appendFixed(*col, m_row, value, !m_null);
+    }
+
+    ColumnsList& m_columns;
+    unsigned& m_colIdx;
+    std::uint32_t m_row = 0U;
+    bool m_null = false;
+};
+
+}  // namespace
+
+ColumnarDumpMessageHandler::ColumnarDumpMessageHandler(const QString& filename)
+  : m_file(filename)
+{
+    if (!m_file.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+        return;
+    }
+
+    m_file.write(FileMagic, sizeof(FileMagic) - 1);
+}
+
+ColumnarDumpMessageHandler::~ColumnarDumpMessageHandler()
+{
+    flush();
+}
+
+bool ColumnarDumpMessageHandler::isOpen() const
+{
+    return m_file.isOpen();
+}
+
+void ColumnarDumpMessageHandler::flush()
+{
+    for (auto& t : m_tables) {
+        writeBatch(t.second);
+    }
+
+    if (m_file.isOpen()) {
+        m_file.flush();
+    }
+}
+
+void ColumnarDumpMessageHandler::beginMsgHandlingImpl(cc::Message& msg)
+{
+    // The schema records the message ID, which may differ at runtime
+    // for the same message type.
+    TableKey key(std::type_index(typeid(msg)), msg.idAsString());
+    auto iter = m_tables.find(key);
+    m_newTable = (iter == m_tables.end());
+    if (m_newTable) {
+        auto& table = m_tables[key];
+        table.m_id = static_cast<std::uint32_t>(m_tables.size() - 1U);
+
+        Column timestampCol;
+        timestampCol.m_type = ColumnType::UInt64;
+        timestampCol.m_name = "timestamp";
+        table.m_columns.push_back(timestampCol);
+
+        Column typeCol;
+        typeCol.m_type = ColumnType::UInt64;
+        typeCol.m_name = "type";
+        table.m_columns.push_back(typeCol);
+        m_currTable = &table;
+    }
+    else {
+        m_currTable = &iter->second;
+    }
+
+    m_currMsg = &msg;
+    m_fieldsProps = &msg.fieldsProperties();
+    m_fieldIdx = 0U;
+    m_colIdx = 0U;
+
+    auto row = m_currTable->m_rows;
+    auto& columns = m_currTable->m_columns;
+    appendFixed(columns[m_colIdx], row, cc::property::message::Timestamp().getFrom(msg), true);
+    ++m_colIdx;
+
+    auto type = cc::property::message::Type().getFrom(msg);
+    appendFixed(columns[m_colIdx], row, static_cast<std::uint64_t>(type), true);
+    ++m_colIdx;
+}
+
+void ColumnarDumpMessageHandler::addFieldImpl(FieldWrapperPtr wrapper)
+{
+    assert(m_currTable != nullptr);
+    assert(m_fieldsProps != nullptr);
+    if (m_newTable) {
+        auto props = m_fieldsProps->value(static_cast<int>(m_fieldIdx)).toMap();
+        auto name = cc::property::field::Common(props).name();
+        if (name.isEmpty()) {
+            name = QString::number(m_fieldIdx);
+        }
+
+        LayoutBuilder builder(m_currTable->m_columns, name, props);
+        wrapper->dispatch(builder);
+    }
+
+    RowWriter writer(m_currTable->m_columns, m_colIdx, m_currTable->m_rows);
+    wrapper->dispatch(writer);
+    ++m_fieldIdx;
+}
+
+void ColumnarDumpMessageHandler::endMsgHandlingImpl()
+{
+    assert(m_currTable != nullptr);
+    assert(m_currMsg != nullptr);
+    auto& table = *m_currTable;
+    auto row = table.m_rows;
+    for (; m_colIdx < table.m_columns.size(); ++m_colIdx) {
+        auto& col = table.m_columns[m_colIdx];
+        if (isFixedWidth(col.m_type)) {
+            appendFixed(col, row, 0U, false);
+        }
+        else {
+            appendVar(col, row, nullptr, 0U, false);
+        }
+    }
+
+    if (m_newTable) {
+        writeSchema(*m_currMsg, table);
+    }
+
+    ++table.m_rows;
+    if (RowsPerBatch <= table.m_rows) {
+        writeBatch(table);
+    }
+
+    m_currTable = nullptr;
+    m_currMsg = nullptr;
+    m_fieldsProps = nullptr;
+}
+
+void ColumnarDumpMessageHandler::writeSchema(
+    cc::Message& msg,
+    const Table& table)
+{
+    DataBuf buf;
+    buf.push_back(static_cast<std::uint8_t>(SchemaRecord));
+    appendLe(buf, table.m_id, sizeof(std::uint32_t));
+
+    auto id = msg.idAsString().toUtf8();
+    appendStr(buf, id.constData(), static_cast<std::size_t>(id.size()));
+
+    auto* name = msg.name();
+    appendStr(buf, name, std::strlen(name));
+
+    appendLe(buf, table.m_columns.size(), sizeof(std::uint32_t));
+    for (auto& col : table.m_columns) {
+        buf.push_back(static_cast<std::uint8_t>(col.m_type));
+        appendStr(buf, col.m_name.c_str(), col.m_name.size());
+    }
+    writeOut(buf);
+}
+
+void ColumnarDumpMessageHandler::writeBatch(Table& table)
+{
+    if (table.m_rows == 0U) {
+        return;
+    }
+
+    DataBuf buf;
+    buf.push_back(static_cast<std::uint8_t>(BatchRecord));
+    appendLe(buf, table.m_id, sizeof(std::uint32_t));
+    appendLe(buf, table.m_rows, sizeof(std::uint32_t));
+    for (auto& col : table.m_columns) {
+        assert(col.m_validity.size() == ((table.m_rows + 7U) / 8U));
+        buf.insert(buf.end(), col.m_validity.begin(), col.m_validity.end());
+        if (!isFixedWidth(col.m_type)) {
+            assert(col.m_offsets.size() == (table.m_rows + 1U));
+            for (auto offset : col.m_offsets) {
+                appendLe(buf, offset, sizeof(offset));
+            }
+        }
+        buf.insert(buf.end(), col.m_data.begin(), col.m_data.end());
+        resetColumn(col);
+    }
+
+    table.m_rows = 0U;
+    writeOut(buf);
+}
+
+void ColumnarDumpMessageHandler::writeOut(const DataBuf& buf)
+{
+    if (!m_file.isOpen()) {
+        return;
+    }
+
+    m_file.write(reinterpret_cast<const char*>(buf.data()), static_cast<qint64>(buf.size()));
+}
+
+}  // namespace comms_dump
@@ -0,0 +1,121 @@
+//
+// Copyright 2017 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+#include <map>
+#include <utility>
+#include <typeindex>
+
+#include "comms/CompileControl.h"
+
+CC_DISABLE_WARNINGS()
+#include <QtCore/QString>
+#include <QtCore/QFile>
+CC_ENABLE_WARNINGS()
+
+#include "comms_champion/MessageHandler.h"
+
+namespace comms_dump
+{
+
+/// @brief Writes handled messages into binary columnar file.
+/// @details Every message type gets its own table. The columns layout
+///     of the table is computed once, when the first message of the type
+///     is handled. Composite fields (bundles, bitfields, optionals) are
+///     flattened into separate columns, lists and variants are stored
+///     as their serialised value. Rows are accumulated in memory and
+///     written as batches of columns.
+///
+///     File format (all integers are little endian):
+///     @code
+///     file   := "CCCOLS01" record*
+///     record := 'S' u32(tableId) str(msgId) str(msgName) u32(colsCount) (u8(colType) str(colName))*
+///             | 'B' u32(tableId) u32(rowsCount) column*
+///     column := validity[(rowsCount + 7) / 8] values
+///     values := u64[rowsCount]                        ; Int64, UInt64 and Float64 columns
+///             | u32 offsets[rowsCount + 1] u8 data[]  ; String and Bytes columns
+///     str    := u32(length) u8 utf8[length]
+///     @endcode
+class ColumnarDumpMessageHandler : public comms_champion::MessageHandler
+{
+public:
+    enum class ColumnType : std::uint8_t
+    {
+        Int64,
+        UInt64,
+        Float64,
+        String,
+        Bytes,
+        NumOfValues
+    };
+
+    struct Column
+    {
+        ColumnType m_type = ColumnType::Bytes;
+        std::string m_name;
+        std::vector<std::uint8_t> m_validity;
+        std::vector<std::uint8_t> m_data;
+        std::vector<std::uint32_t> m_offsets;
+    };
+
+    explicit ColumnarDumpMessageHandler(const QString& filename);
+
+    virtual ~ColumnarDumpMessageHandler();
+
+    bool isOpen() const;
+
+    void flush();
+
+protected:
+    virtual void beginMsgHandlingImpl(comms_champion::Message& msg) override;
+    virtual void addFieldImpl(FieldWrapperPtr wrapper) override;
+    virtual void endMsgHandlingImpl() override;
+
+private:
+    struct Table
+    {
+        std::uint32_t m_id = 0U;
+        std::vector<Column> m_columns;
+        std::uint32_t m_rows = 0U;
+    };
+
+    typedef std::pair<std::type_index, QString> TableKey;
+    typedef std::map<TableKey, Table> TablesMap;
+    typedef std::vector<std::uint8_t> DataBuf;
+
+    void writeSchema(comms_champion::Message& msg, const Table& table);
+    void writeBatch(Table& table);
+    void writeOut(const DataBuf& buf);
+
+    QFile m_file;
+    TablesMap m_tables;
+    Table* m_currTable = nullptr;
+    const QVariantList* m_fieldsProps = nullptr;
+    comms_champion::Message* m_currMsg = nullptr;
+    unsigned m_fieldIdx = 0U;
+    unsigned m_colIdx = 0U;
+    bool m_newTable = false;
+};
+
+}  // namespace comms_dump
+
@@ -18,7 +18,9 @@
 
 #include "CsvDumpMessageHandler.h"
 
-#include <iomanip>
+#include <cstdio>
+#include <cassert>
+#include <algorithm>
 
 #include "comms_champion/field_wrapper/FieldWrapperHandler.h"
 #include "comms_champion/property/message.h"
@@ -32,14 +34,80 @@ namespace
 {
 
 const char Endl = '\n';
+const std::size_t WriteOutThreshold = 64U * 1024U;
+
+void appendUnsigned(std::string& buf, unsigned long long value)
+{
+    char digits[20];
+    auto pos = sizeof(digits);
+    do {
+        --pos;
+        digits[pos] = static_cast<char>('0' + (value % 10U));
+        value /= 10U;
+    } while (value != 0U);
+
+    buf.append(&digits[pos], sizeof(digits) - pos);
+}
+
+void appendSigned(std::string& buf, long long value)
+{
+    if (value < 0) {
+        buf.push_back('-');
+        appendUnsigned(buf, 0ULL - static_cast<unsigned long long>(value));
+        return;
+    }
+
+    appendUnsigned(buf, static_cast<unsigned long long>(value));
+}
+
+const char HexChars[] = "0123456789abcdef";
+
+void appendHex(std::string& buf, unsigned long long value, std::size_t minWidth)
+{
+    char digits[16];
+    auto pos = sizeof(digits);
+    auto minPos = sizeof(digits) - std::min(minWidth, sizeof(digits));
+    do {
+        --pos;
+        digits[pos] = HexChars[value & 0xf];
+        value >>= 4;
+    } while ((value != 0U) || (minPos < pos));
+
+    buf.append(&digits[pos], sizeof(digits) - pos);
+}
+
+void appendHexBytes(std::string& buf, const cc::field_wrapper::FieldWrapper::SerialisedSeq& seq)
+{
+    for (auto byte : seq) {
+        buf.push_back(HexChars[(byte >> 4) & 0xf]);
+        buf.push_back(HexChars[byte & 0xf]);
+    }
+}
+
+void appendFloat(std::string& buf, double value)
+{
+    char str[32];
+    auto len = std::snprintf(str, sizeof(str), "%g", value);
+    if (len <= 0) {
+        return;
+    }
+
+    buf.append(str, std::min(static_cast<std::size_t>(len), sizeof(str) - 1));
+}
+
+void appendQString(std::string& buf, const QString& str)
+{
+    auto utf8 = str.toUtf8();
+    buf.append(utf8.constData(), static_cast<std::size_t>(utf8.size()));
+}
 
 }  // namespace
 
 class CsvDumpFieldsHandler : public cc::field_wrapper::FieldWrapperHandler
 {
 public:
-    CsvDumpFieldsHandler(std::ostream& out, const std::string& sep)
-      : m_out(out),
+    CsvDumpFieldsHandler(std::string& buf, const std::string& sep)
+      : m_buf(buf),
         m_sep(sep)
     {
     }
@@ -48,28 +116,35 @@ public:
 
     virtual void handle(cc::field_wrapper::IntValueWrapper& wrapper) override
     {
-        m_out << m_sep << wrapper.getValue();
+        m_buf.append(m_sep);
+        appendSigned(m_buf, wrapper.getValue());
     }
 
     virtual void handle(cc::field_wrapper::UnsignedLongValueWrapper& wrapper) override
     {
-        m_out << m_sep << wrapper.getValue();
+        m_buf.append(m_sep);
+        appendUnsigned(m_buf, wrapper.getValue());
     }
 
     virtual void handle(cc::field_wrapper::BitmaskValueWrapper& wrapper) override
     {
-        m_out << m_sep << "0x" << std::setw(wrapper.length() * 2) <<
-            std::setfill('0') << std::hex << wrapper.getValue() << std::dec;
+        m_buf.append(m_sep);
+        m_buf.append("0x", 2);
+        appendHex(m_buf, wrapper.getValue(), wrapper.length() * 2);
     }
 
     virtual void handle(cc::field_wrapper::EnumValueWrapper& wrapper) override
     {
-        m_out << m_sep << wrapper.getValue();
+        m_buf.append(m_sep);
+        appendSigned(m_buf, wrapper.getValue());
     }
 
     virtual void handle(cc::field_wrapper::StringWrapper& wrapper) override
     {
-        m_out << m_sep << '\"' << wrapper.getValue().toStdString() << '\"' ;
+        m_buf.append(m_sep);
+        m_buf.push_back('\"');
+        appendQString(m_buf, wrapper.getValue());
+        m_buf.push_back('\"');
     }
 
     virtual void handle(cc::field_wrapper::BitfieldWrapper& wrapper) override
@@ -100,14 +175,19 @@ public:
 
     virtual void handle(cc::field_wrapper::ArrayListRawDataWrapper& wrapper) override
     {
-        m_out << m_sep << '\"' << wrapper.getValue().toStdString() << '\"';
+        m_buf.append(m_sep);
+        m_buf.push_back('\"');
+        auto value = wrapper.getValue().toLatin1();
+        m_buf.append(value.constData(), static_cast<std::size_t>(value.size()));
+        m_buf.push_back('\"');
     }
 
     virtual void handle(cc::field_wrapper::ArrayListWrapper& wrapper) override
     {
         auto& members = wrapper.getMembers();
         if (!wrapper.hasFixedSize()) {
-            m_out << m_sep << members.size();
+            m_buf.append(m_sep);
+            appendUnsigned(m_buf, members.size());
         }
 
         for (auto& mem : members) {
@@ -117,18 +197,26 @@ public:
 
     virtual void handle(cc::field_wrapper::FloatValueWrapper& wrapper) override
     {
-        m_out << m_sep << wrapper.getValue();
+        m_buf.append(m_sep);
+        appendFloat(m_buf, wrapper.getValue());
     }
 
     virtual void handle(cc::field_wrapper::VariantWrapper& wrapper) override
     {
-        static_cast<void>(wrapper);
-        assert(!"NYI");
+        auto& member = wrapper.getCurrent();
+        if (!member) {
+            return;
+        }
+
+        member->dispatch(*this);
     }
 
     virtual void handle(cc::field_wrapper::UnknownValueWrapper& wrapper) override
     {
-        m_out << m_sep << '\"' << wrapper.getSerialisedString().toStdString() << '\"';
+        m_buf.append(m_sep);
+        m_buf.push_back('\"');
+        appendHexBytes(m_buf, wrapper.getSerialisedValue());
+        m_buf.push_back('\"');
     }
 
     virtual void handle(cc::field_wrapper::FieldWrapper& wrapper) override
@@ -138,7 +226,7 @@ public:
     }
 
 private:
-    std::ostream& m_out;
+    std::string& m_buf;
     std::string m_sep;
 };
 
@@ -147,12 +235,21 @@ CsvDumpMessageHandler::CsvDumpMessageHandler(
     const std::string& sep)
   : m_out(out),
     m_sep(sep),
-    m_fieldsDump(new CsvDumpFieldsHandler(out, sep))
+    m_fieldsDump(new CsvDumpFieldsHandler(m_buf, sep))
 {
+    m_buf.reserve(WriteOutThreshold * 2);
 }
 
-CsvDumpMessageHandler::~CsvDumpMessageHandler() = default;
+CsvDumpMessageHandler::~CsvDumpMessageHandler()
+{
+    flush();
+}
 
+void CsvDumpMessageHandler::flush()
+{
+    writeOut();
+    m_out.flush();
+}
 
 void CsvDumpMessageHandler::beginMsgHandlingImpl(cc::Message& msg)
 {
@@ -177,15 +274,17 @@ void CsvDumpMessageHandler::beginMsgHandlingImpl(cc::Message& msg)
             type = cc::Message::Type::Invalid;
         }
 
-        m_out << DirMap[static_cast<unsigned>(type)] << m_sep;
+        m_buf.append(DirMap[static_cast<unsigned>(type)]);
+        m_buf.append(m_sep);
     }
 
     auto timestamp = cc::property::message::Timestamp().getFrom(msg);
     if (timestamp != 0) {
-        m_out << timestamp << m_sep;
+        appendUnsigned(m_buf, timestamp);
+        m_buf.append(m_sep);
     }
 
-    m_out << msg.idAsString().toStdString();
+    m_buf.append(msgIdStr(msg));
 }
 
 void CsvDumpMessageHandler::addFieldImpl(FieldWrapperPtr wrapper)
@@ -195,8 +294,35 @@ void CsvDumpMessageHandler::addFieldImpl(FieldWrapperPtr wrapper)
 
 void CsvDumpMessageHandler::endMsgHandlingImpl()
 {
-    m_out << Endl;
+    m_buf.push_back(Endl);
+    if (WriteOutThreshold <= m_buf.size()) {
+        writeOut();
+    }
+}
+
+const std::string& CsvDumpMessageHandler::msgIdStr(cc::Message& msg)
+{
+    // The same message type may report different IDs at runtime,
+    // the converted string is cached per ID value.
+    auto id = msg.idAsString();
+    auto iter = m_msgIds.find(id);
+    if (iter != m_msgIds.end()) {
+        return iter->second;
+    }
+
+    auto& idStr = m_msgIds[id];
+    appendQString(idStr, id);
+    return idStr;
 }
 
-}  // namespace comms_dump
+void CsvDumpMessageHandler::writeOut()
+{
+    if (m_buf.empty()) {
+        return;
+    }
 
+    m_out.write(m_buf.data(), static_cast<std::streamsize>(m_buf.size()));
+    m_buf.clear();
+}
+
+}  // namespace comms_dump
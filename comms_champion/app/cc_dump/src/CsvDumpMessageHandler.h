@@ -20,6 +20,14 @@
 
 #include <iostream>
 #include <memory>
+#include <string>
+#include <map>
+
+#include "comms/CompileControl.h"
+
+CC_DISABLE_WARNINGS()
+#include <QtCore/QString>
+CC_ENABLE_WARNINGS()
 
 #include "comms_champion/MessageHandler.h"
 
@@ -36,19 +44,12 @@ public:
 
     virtual ~CsvDumpMessageHandler();
 
-    std::ostream& outStream()
-    {
-        return m_out;
-    }
-
     void setShowType(bool enabled)
     {
         m_showType = enabled;
     }
 
-    void flush() {
-        m_out.flush();
-    }
+    void flush();
 
 protected:
     virtual void beginMsgHandlingImpl(comms_champion::Message& msg) override;
@@ -56,12 +57,18 @@ protected:
     virtual void endMsgHandlingImpl() override;
 
 private:
+    typedef std::map<QString, std::string> MsgIdsMap;
+
+    const std::string& msgIdStr(comms_champion::Message& msg);
+    void writeOut();
+
     std::ostream& m_out;
     std::string m_sep;
+    std::string m_buf;
     std::unique_ptr<CsvDumpFieldsHandler> m_fieldsDump;
+    MsgIdsMap m_msgIds;
     bool m_showType = false;
 };
 
 }  // namespace comms_dump
 
-
@@ -0,0 +1,351 @@
+//
+// Copyright 2017 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#include "LoadGenerator.h"
+
+#include <iostream>
+#include <algorithm>
+#include <cassert>
+
+#include "comms_champion/property/message.h"
+
+namespace cc = comms_champion;
+
+namespace comms_dump
+{
+
+namespace
+{
+
+const int SendInterval = 1;
+const int ReportInterval = 1000;
+const std::size_t MaxBatch = 10000U;
+const std::size_t FastBatch = 256U;
+const std::size_t MaxPendingBytes = 1024U * 1024U;
+const std::size_t MaxInFlight = 100000U;
+
+}  // namespace
+
+LoadGenerator::LoadGenerator(const Config& config, SetupFunc&& setupFunc)
+  : m_config(config),
+    m_setupFunc(std::move(setupFunc))
+{
+    m_sendTimer.setTimerType(Qt::PreciseTimer);
+    connect(
+        &m_sendTimer, SIGNAL(timeout()),
+        this, SLOT(sendPending()));
+
+    connect(
+        &m_reportTimer, SIGNAL(timeout()),
+        this, SLOT(reportProgress()));
+}
+
+LoadGenerator::~LoadGenerator() = default;
+
+bool LoadGenerator::start(const MessagesList& msgs)
+{
+    if (msgs.empty()) {
+        std::cerr << "ERROR: No messages to generate load with" << std::endl;
+        return false;
+    }
+
+    // The same templates are sent over and over, let MsgMgr reuse
+    // their serialised frames.
+    for (auto& msg : msgs) {
+        assert(msg);
+        cc::property::message::FrameCacheKey().setTo(cc::MsgMgr::allocFrameCacheKey(), *msg);
+    }
+    m_mix.assign(msgs.begin(), msgs.end());
+
+    auto connCount = std::max(m_config.m_connections, 1U);
+    for (auto idx = 0U; idx < connCount; ++idx) {
+        ConnectionPtr conn(new Connection);
+        if (!m_setupFunc(conn->m_msgMgr)) {
+            std::cerr << "ERROR: Failed to setup load connection" << std::endl;
+            return false;
+        }
+
+        // Socket plugins may provide the same socket object every time,
+        // every connection must have its own one.
+        auto connSocket = conn->m_msgMgr.getSocket();
+        auto sameSocketIter =
+            std::find_if(
+                m_connections.begin(), m_connections.end(),
+                [&connSocket](const ConnectionPtr& other) -> bool
+                {
+                    return other->m_msgMgr.getSocket() == connSocket;
+                });
+
+        if (sameSocketIter != m_connections.end()) {
+            std::cerr << "ERROR: Socket plugin doesn't create separate sockets, "
+                         "multiple load connections are not supported" << std::endl;
+            return false;
+        }
+
+        auto* connPtr = conn.get();
+        conn->m_msgMgr.setMsgAddedCallbackFunc(
+            [this, connPtr](cc::MessagePtr msg)
+            {
+                assert(msg);
+                auto type = cc::property::message::Type().getFrom(*msg);
+                if (type == cc::Message::Type::Received) {
+                    msgReceived(*connPtr, *msg);
+                }
+            });
+
+        // The generated messages are not dumped anywhere, don't keep them
+        conn->m_msgMgr.setStoreMsgsEnabled(false);
+        conn->m_msgMgr.setRecvEnabled(true);
+        conn->m_msgMgr.start();
+
+        auto socket = conn->m_msgMgr.getSocket();
+        if (!socket) {
+            std::cerr << "ERROR: Socket plugin hasn't been chosen or doesn't exist" << std::endl;
+            return false;
+        }
+
+        if (!socket->socketConnect()) {
+            std::cerr << "WARNING: Load connection " << idx << " failed to connect!" << std::endl;
+        }
+
+        m_connections.push_back(std::move(conn));
+    }
+
+    auto protocol = m_connections.front()->m_msgMgr.getProtocol();
+    assert(protocol);
+    calcFrameSizes(*protocol);
+
+    m_startTime = Clock::now();
+    m_lastReportTime = m_startTime;
+    m_running = true;
+    m_sendTimer.start(SendInterval);
+    m_reportTimer.start(ReportInterval);
+    return true;
+}
+
+void LoadGenerator::sendPending()
+{
+    if (!m_running) {
+        return;
+    }
+
+    auto now = Clock::now();
+    auto elapsed = now - m_startTime;
+    if (std::chrono::milliseconds(m_config.m_durationMs) <= elapsed) {
+        finish();
+        return;
+    }
+
+    assert(!m_connections.empty());
+    if (m_config.m_rate == 0U) {
+        for (auto& conn : m_connections) {
+            sendTo(*conn, FastBatch);
+        }
+        return;
+    }
+
+    auto elapsedSec = std::chrono::duration<double>(elapsed).count();
+    auto due = static_cast<unsigned long long>(elapsedSec * m_config.m_rate);
+    auto sent = m_total.m_sentMsgs + m_interval.m_sentMsgs;
+    if (due <= sent) {
+        return;
+    }
+
+    auto toSend = static_cast<std::size_t>(std::min(due - sent, static_cast<unsigned long long>(MaxBatch)));
+    auto perConn = ((toSend - 1U) / m_connections.size()) + 1U;
+    for (std::size_t attempt = 0U; (attempt < m_connections.size()) && (0U < toSend); ++attempt) {
+        auto& conn = m_connections[m_nextConnIdx];
+        m_nextConnIdx = (m_nextConnIdx + 1U) % m_connections.size();
+
+        auto count = std::min(perConn, toSend);
+        if (sendTo(*conn, count)) {
+            toSend -= count;
+        }
+    }
+}
+
+void LoadGenerator::reportProgress()
+{
+    auto now = Clock::now();
+    auto seconds = std::chrono::duration<double>(now - m_lastReportTime).count();
+    printStats("Load", m_interval, m_intervalRtt, seconds);
+
+    m_total.m_sentMsgs += m_interval.m_sentMsgs;
+    m_total.m_sentBytes += m_interval.m_sentBytes;
+    m_total.m_receivedMsgs += m_interval.m_receivedMsgs;
+    m_total.m_unmatchedMsgs += m_interval.m_unmatchedMsgs;
+    m_total.m_throttled += m_interval.m_throttled;
+    m_total.m_maxPendingBytes =
+        std::max(m_total.m_maxPendingBytes, m_interval.m_maxPendingBytes);
+    m_totalRtt.merge(m_intervalRtt);
+
+    m_interval = Counters();
+    m_intervalRtt.reset();
+    m_lastReportTime = now;
+}
+
+void LoadGenerator::calcFrameSizes(cc::Protocol& protocol)
+{
+    // Sent bytes are counted by the serialised frame size of the
+    // message template.
+    m_mixFrameSizes.clear();
+    m_mixFrameSizes.reserve(m_mix.size());
+    for (auto& tmpl : m_mix) {
+        std::size_t size = 0U;
+        auto msg = protocol.cloneMessage(*tmpl);
+        if (msg) {
+            auto dataPtr = protocol.write(*msg);
+            if (dataPtr) {
+                size = dataPtr->m_data.size();
+            }
+        }
+        m_mixFrameSizes.push_back(size);
+    }
+}
+
+bool LoadGenerator::sendTo(Connection& conn, std::size_t count)
+{
+    if (MaxPendingBytes <= pendingBytes(conn)) {
+        ++m_interval.m_throttled;
+        return false;
+    }
+
+    auto protocol = conn.m_msgMgr.getProtocol();
+    assert(protocol);
+    assert(!m_mix.empty());
+
+    MessagesList msgs;
+    auto now = Clock::now();
+    for (std::size_t idx = 0U; idx < count; ++idx) {
+        auto mixIdx = conn.m_nextMsgIdx;
+        conn.m_nextMsgIdx = (conn.m_nextMsgIdx + 1U) % m_mix.size();
+
+        auto& tmpl = m_mix[mixIdx];
+        auto msg = protocol->cloneMessage(*tmpl);
+        if (!msg) {
+            continue;
+        }
+
+        cc::property::message::FrameCacheKey().copyFromTo(*tmpl, *msg);
+
+        auto& inFlight = conn.m_inFlight[msg->idAsString()];
+        if (MaxInFlight <= inFlight.size()) {
+            inFlight.pop_front();
+        }
+        inFlight.push_back(now);
+        msgs.push_back(std::move(msg));
+
+        assert(mixIdx < m_mixFrameSizes.size());
+        m_interval.m_sentBytes += m_mixFrameSizes[mixIdx];
+    }
+
+    m_interval.m_sentMsgs += msgs.size();
+    conn.m_msgMgr.sendMsgs(std::move(msgs));
+    m_interval.m_maxPendingBytes =
+        std::max(m_interval.m_maxPendingBytes, pendingBytes(conn));
+    return true;
+}
+
+void LoadGenerator::msgReceived(Connection& conn, cc::Message& msg)
+{
+    ++m_interval.m_receivedMsgs;
+
+    // The echoes of the same message ID are expected in the send order,
+    // the oldest in flight message of the ID is the matching one.
+    auto iter = conn.m_inFlight.find(msg.idAsString());
+    if ((iter == conn.m_inFlight.end()) || (iter->second.empty())) {
+        ++m_interval.m_unmatchedMsgs;
+        return;
+    }
+
+    auto rtt = Clock::now() - iter->second.front();
+    iter->second.pop_front();
+    m_intervalRtt.record(
+        static_cast<cc::LatencyHistogram::ValueType>(
+            std::chrono::duration_cast<std::chrono::microseconds>(rtt).count()));
+}
+
+std::size_t LoadGenerator::pendingBytes(Connection& conn) const
+{
+    auto socket = conn.m_msgMgr.getSocket();
+    if (!socket) {
+        return 0U;
+    }
+
+    return socket->pendingSendBytes();
+}
+
+void LoadGenerator::finish()
+{
+    if (!m_running) {
+        return;
+    }
+
+    m_running = false;
+    m_sendTimer.stop();
+    m_reportTimer.stop();
+    reportProgress();
+
+    auto seconds = std::chrono::duration<double>(Clock::now() - m_startTime).count();
+    printStats("Load total", m_total, m_totalRtt, seconds);
+
+    for (auto& conn : m_connections) {
+        conn->m_msgMgr.stop();
+    }
+
+    if (m_finishedCallback) {
+        m_finishedCallback();
+    }
+}
+
+void LoadGenerator::printStats(
+    const char* prefix,
+    const Counters& counters,
+    const cc::LatencyHistogram& rtt,
+    double seconds)
+{
+    if (seconds <= 0.0) {
+        return;
+    }
+
+    std::cerr << "INFO: " << prefix << ": sent " <<
+        static_cast<unsigned long long>(counters.m_sentMsgs / seconds) << " msgs/s (" <<
+        static_cast<unsigned long long>(counters.m_sentBytes / seconds) << " bytes/s), received " <<
+        static_cast<unsigned long long>(counters.m_receivedMsgs / seconds) << " msgs/s, " <<
+        "max pending " << counters.m_maxPendingBytes << " bytes";
+
+    if (counters.m_throttled != 0U) {
+        std::cerr << ", throttled " << counters.m_throttled << " times";
+    }
+
+    if (counters.m_unmatchedMsgs != 0U) {
+        std::cerr << ", unmatched " << counters.m_unmatchedMsgs << " msgs";
+    }
+
+    if (rtt.count() != 0U) {
+        std::cerr << "; RTT us: p50=" << rtt.valueAtPercentile(50.0) <<
+            " p90=" << rtt.valueAtPercentile(90.0) <<
+            " p99=" << rtt.valueAtPercentile(99.0) <<
+            " p99.9=" << rtt.valueAtPercentile(99.9) <<
+            " max=" << rtt.max();
+    }
+    std::cerr << std::endl;
+}
+
+} /* namespace comms_dump */
+
@@ -0,0 +1,132 @@
+//
+// Copyright 2017 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#pragma once
+
+#include <memory>
+#include <vector>
+#include <deque>
+#include <map>
+#include <chrono>
+#include <functional>
+
+#include "comms/CompileControl.h"
+
+CC_DISABLE_WARNINGS()
+#include <QtCore/QObject>
+#include <QtCore/QString>
+#include <QtCore/QTimer>
+CC_ENABLE_WARNINGS()
+
+#include "comms_champion/MsgMgr.h"
+#include "comms_champion/LatencyHistogram.h"
+
+namespace comms_dump
+{
+
+/// @brief Sends provided mix of messages at configured rate (or as fast
+///     as possible) over multiple connections and reports achieved
+///     throughput. When the peer echoes the messages back, the round-trip
+///     latency is measured as well. The echoed messages are matched to the
+///     sent ones by their ID only, the peer is assumed to echo the messages
+///     of the same ID in the order they were sent.
+class LoadGenerator : public QObject
+{
+    Q_OBJECT
+public:
+    typedef comms_champion::MsgMgr::MessagesList MessagesList;
+    typedef std::function<bool (comms_champion::MsgMgr& msgMgr)> SetupFunc;
+    typedef std::function<void ()> FinishedCallbackFunc;
+
+    struct Config
+    {
+        unsigned m_durationMs = 0U;
+        unsigned m_rate = 0U; // messages per second, 0 means as fast as possible
+        unsigned m_connections = 1U; // every one requires separate socket object
+    };
+
+    LoadGenerator(const Config& config, SetupFunc&& setupFunc);
+    ~LoadGenerator();
+
+    template <typename TFunc>
+    void setFinishedCallbackFunc(TFunc&& func)
+    {
+        m_finishedCallback = std::forward<TFunc>(func);
+    }
+
+    bool start(const MessagesList& msgs);
+
+private slots:
+    void sendPending();
+    void reportProgress();
+
+private:
+    typedef std::chrono::steady_clock Clock;
+    typedef Clock::time_point TimePoint;
+    typedef std::deque<TimePoint> InFlightTimestamps;
+
+    struct Connection
+    {
+        comms_champion::MsgMgr m_msgMgr;
+        std::map<QString, InFlightTimestamps> m_inFlight; // per message ID, in send order
+        std::size_t m_nextMsgIdx = 0U;
+    };
+
+    typedef std::unique_ptr<Connection> ConnectionPtr;
+
+    struct Counters
+    {
+        unsigned long long m_sentMsgs = 0U;
+        unsigned long long m_sentBytes = 0U;
+        unsigned long long m_receivedMsgs = 0U;
+        unsigned long long m_unmatchedMsgs = 0U;
+        unsigned long long m_throttled = 0U;
+        std::size_t m_maxPendingBytes = 0U;
+    };
+
+    void calcFrameSizes(comms_champion::Protocol& protocol);
+    bool sendTo(Connection& conn, std::size_t count);
+    void msgReceived(Connection& conn, comms_champion::Message& msg);
+    std::size_t pendingBytes(Connection& conn) const;
+    void finish();
+    void printStats(
+        const char* prefix,
+        const Counters& counters,
+        const comms_champion::LatencyHistogram& rtt,
+        double seconds);
+
+    Config m_config;
+    SetupFunc m_setupFunc;
+    FinishedCallbackFunc m_finishedCallback;
+    std::vector<ConnectionPtr> m_connections;
+    std::vector<comms_champion::MessagePtr> m_mix;
+    std::vector<std::size_t> m_mixFrameSizes;
+    QTimer m_sendTimer;
+    QTimer m_reportTimer;
+    TimePoint m_startTime;
+    TimePoint m_lastReportTime;
+    Counters m_total;
+    Counters m_interval;
+    comms_champion::LatencyHistogram m_totalRtt;
+    comms_champion::LatencyHistogram m_intervalRtt;
+    std::size_t m_nextConnIdx = 0U;
+    bool m_running = false;
+};
+
+} /* namespace comms_dump */
+
@@ -18,29 +18,165 @@
 
 #include "RecordMessageHandler.h"
 
+#include <cassert>
+
 namespace cc = comms_champion;
 
 namespace comms_dump
 {
 
-RecordMessageHandler::RecordMessageHandler(const QString& filename)
+namespace
+{
+
+const std::size_t MaxPendingMsgs = 1024U * 1024U;
+const std::size_t EarlyCommitThreshold = MaxPendingMsgs / 4U;
+
+}  // namespace
+
+RecordMessageHandler::RecordMessageHandler(
+    const QString& filename,
+    unsigned commitIntervalMs)
+  : m_commitInterval(commitIntervalMs),
+    m_bytes(0U),
+    m_lastReportTime(Clock::now())
 {
     m_saveHandler = cc::MsgFileMgr::startRecvSave(filename);
+    if (m_saveHandler) {
+        m_thread = std::thread(&RecordMessageHandler::writerThreadFunc, this);
+    }
 }
 
-RecordMessageHandler::~RecordMessageHandler() = default;
+RecordMessageHandler::~RecordMessageHandler()
+{
+    if (!m_thread.joinable()) {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> guard(m_mutex);
+        m_stopRequested = true;
+    }
+    m_cond.notify_one();
+    m_thread.join();
+}
 
 void RecordMessageHandler::flush()
 {
-    if (m_saveHandler) {
-        cc::MsgFileMgr::flushRecvFile(m_saveHandler);
+    {
+        std::lock_guard<std::mutex> guard(m_mutex);
+        m_flushRequested = true;
     }
+    m_cond.notify_one();
+}
+
+RecordMessageHandler::Stats RecordMessageHandler::getStats()
+{
+    Stats stats;
+    {
+        std::lock_guard<std::mutex> guard(m_mutex);
+        stats.m_queued = m_pending.size();
+        stats.m_dropped = m_dropped;
+    }
+
+    stats.m_bytes = m_bytes.load();
+
+    auto now = Clock::now();
+    auto elapsedMs =
+        std::chrono::duration_cast<std::chrono::milliseconds>(
+            now - m_lastReportTime).count();
+    if (0 < elapsedMs) {
+        stats.m_bytesPerSec =
+            ((stats.m_bytes - m_lastReportBytes) * 1000U) /
+                static_cast<unsigned long long>(elapsedMs);
+    }
+
+    m_lastReportBytes = stats.m_bytes;
+    m_lastReportTime = now;
+    return stats;
 }
 
 void RecordMessageHandler::beginMsgHandlingImpl(cc::Message& msg)
 {
-    if (m_saveHandler) {
-        cc::MsgFileMgr::addToRecvSave(m_saveHandler, msg);
+    if (!m_saveHandler) {
+        return;
+    }
+
+    auto msgInfo = cc::MsgFileMgr::recvMsgInfo(msg);
+    bool commitEarly = false;
+    {
+        std::lock_guard<std::mutex> guard(m_mutex);
+        if (MaxPendingMsgs <= m_pending.size()) {
+            ++m_dropped;
+            return;
+        }
+
+        m_pending.push_back(std::move(msgInfo));
+        commitEarly =
+            (m_pending.size() == EarlyCommitThreshold) ||
+            ((m_commitInterval.count() == 0) && (m_pending.size() == 1U));
+    }
+
+    if (commitEarly) {
+        m_cond.notify_one();
+    }
+}
+
+void RecordMessageHandler::writerThreadFunc()
+{
+    assert(m_saveHandler);
+    MsgsInfoList toWrite;
+    while (true) {
+        bool stop = false;
+        {
+            std::unique_lock<std::mutex> guard(m_mutex);
+            if (m_commitInterval.count() == 0) {
+                // Commit as soon as there is something to write, waiting
+                // for a zero timeout would keep this thread spinning.
+                m_cond.wait(
+                    guard,
+                    [this]() -> bool
+                    {
+                        return
+                            m_stopRequested ||
+                            m_flushRequested ||
+                            (!m_pending.empty());
+                    });
+            }
+            else {
+                m_cond.wait_for(
+                    guard,
+                    m_commitInterval,
+                    [this]() -> bool
+                    {
+                        return
+                            m_stopRequested ||
+                            m_flushRequested ||
+                            (EarlyCommitThreshold <= m_pending.size());
+                    });
+            }
+
+            toWrite.swap(m_pending);
+            m_flushRequested = false;
+            stop = m_stopRequested;
+        }
+
+        if (!toWrite.empty()) {
+            auto startPos = m_saveHandler->pos();
+            for (auto& msgInfo : toWrite) {
+                cc::MsgFileMgr::addToRecvSave(m_saveHandler, msgInfo);
+            }
+            cc::MsgFileMgr::flushRecvFile(m_saveHandler);
+
+            auto endPos = m_saveHandler->pos();
+            if (startPos < endPos) {
+                m_bytes += static_cast<unsigned long long>(endPos - startPos);
+            }
+            toWrite.clear();
+        }
+
+        if (stop) {
+            break;
+        }
     }
 }
 
@@ -19,11 +19,18 @@
 #pragma once
 
 #include <memory>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <chrono>
 
 #include "comms/CompileControl.h"
 
 CC_DISABLE_WARNINGS()
 #include <QtCore/QString>
+#include <QtCore/QVariantMap>
 CC_ENABLE_WARNINGS()
 
 #include "comms_champion/MessageHandler.h"
@@ -32,24 +39,54 @@ CC_ENABLE_WARNINGS()
 namespace comms_dump
 {
 
+/// @brief Records handled messages into the file.
+/// @details Only the properties of the message are retrieved in the
+///     handling thread. The encoding and the write to the file are
+///     performed by the dedicated writer thread, which swaps the
+///     pending messages buffer and commits it to the disk once
+///     every commit interval.
 class RecordMessageHandler : public comms_champion::MessageHandler
 {
 public:
-    RecordMessageHandler(const QString& filename);
+    struct Stats
+    {
+        std::size_t m_queued = 0U;
+        unsigned long long m_dropped = 0U;
+        unsigned long long m_bytes = 0U;
+        unsigned long long m_bytesPerSec = 0U;
+    };
+
+    RecordMessageHandler(const QString& filename, unsigned commitIntervalMs);
 
     virtual ~RecordMessageHandler();
 
     void flush();
 
+    Stats getStats();
+
 protected:
     virtual void beginMsgHandlingImpl(comms_champion::Message& msg) override;
 
 private:
     typedef comms_champion::MsgFileMgr::FileSaveHandler FileSaveHandler;
-    FileSaveHandler m_saveHandler;
+    typedef std::vector<QVariantMap> MsgsInfoList;
+    typedef std::chrono::steady_clock Clock;
 
+    void writerThreadFunc();
+
+    FileSaveHandler m_saveHandler;
+    std::chrono::milliseconds m_commitInterval;
+    std::mutex m_mutex;
+    std::condition_variable m_cond;
+    MsgsInfoList m_pending;
+    bool m_flushRequested = false;
+    bool m_stopRequested = false;
+    std::atomic<unsigned long long> m_bytes;
+    unsigned long long m_dropped = 0U;
+    unsigned long long m_lastReportBytes = 0U;
+    Clock::time_point m_lastReportTime;
+    std::thread m_thread;
 };
 
 }  // namespace comms_dump
 
-
@@ -45,6 +45,16 @@ const QString InMsgsOptStr("received-msgs");
 const QString LastWaitOptStr("last-wait");
 const QString RecordSentOptStr("record-sent");
 const QString QuietOptStr("quiet");
+const QString QuitOnDisconnectOptStr("quit-on-disconnect");
+const QString CaptureOptStr("parse-capture");
+const QString ThreadsOptStr("threads");
+const QString ParseBenchmarkOptStr("parse-benchmark");
+const QString ColumnarOptStr("columnar-out");
+const QString RecordCommitOptStr("record-commit");
+const QString LoadDurationOptStr("load-duration");
+const QString LoadRateOptStr("load-rate");
+const QString LoadConnectionsOptStr("load-connections");
+const QString LatencyStatsOptStr("latency-stats");
 
 void metaTypesRegisterAll()
 {
@@ -100,6 +110,94 @@ void prepareCommandLineOptions(QCommandLineParser& parser)
     );
     parser.addOption(quietOpt);
 
+    QCommandLineOption quitOnDisconnectOpt(
+        QuitOnDisconnectOptStr,
+        QCoreApplication::translate("main", "Exit when the socket reports disconnection, "
+                                            "for example at the end of the replayed file. "
+                                            "Note that some sockets report failure to "
+                                            "connect as disconnection as well.")
+    );
+    parser.addOption(quitOnDisconnectOpt);
+
+    QCommandLineOption captureOpt(
+        QStringList() << "c" << CaptureOptStr,
+        QCoreApplication::translate("main", "Parse raw data capture file instead of "
+                                            "connecting the socket and exit."),
+        QCoreApplication::translate("main", "filename")
+    );
+    parser.addOption(captureOpt);
+
+    QCommandLineOption threadsOpt(
+        QStringList() << "t" << ThreadsOptStr,
+        QCoreApplication::translate("main", "Number of parsing threads used with "
+                                            "\"--parse-capture\". Default is number of cores. "
+                                            "Comma separated list of counts is accepted "
+                                            "with \"--parse-benchmark\"."),
+        QCoreApplication::translate("main", "num")
+    );
+    parser.addOption(threadsOpt);
+
+    QCommandLineOption parseBenchmarkOpt(
+        ParseBenchmarkOptStr,
+        QCoreApplication::translate("main", "Parse the \"--parse-capture\" file once for "
+                                            "every threads count listed in \"--threads\" and "
+                                            "report throughput of each run. The messages "
+                                            "are not dumped.")
+    );
+    parser.addOption(parseBenchmarkOpt);
+
+    QCommandLineOption columnarOpt(
+        QStringList() << "b" << ColumnarOptStr,
+        QCoreApplication::translate("main", "Write received messages into binary "
+                                            "columnar file as well."),
+        QCoreApplication::translate("main", "filename")
+    );
+    parser.addOption(columnarOpt);
+
+    QCommandLineOption recordCommitOpt(
+        RecordCommitOptStr,
+        QCoreApplication::translate("main", "Interval (in milliseconds) of committing "
+                                            "received messages to the storage file. "
+                                            "Default is 250 ms."),
+        QCoreApplication::translate("main", "ms")
+    );
+    parser.addOption(recordCommitOpt);
+
+    QCommandLineOption loadDurationOpt(
+        LoadDurationOptStr,
+        QCoreApplication::translate("main", "Generate load for provided duration (in milliseconds) "
+                                            "using messages from \"--msgs-to-send\" file as "
+                                            "a mix, their delays are ignored. Achieved "
+                                            "throughput and round-trip latency of echoed "
+                                            "messages are reported every second."),
+        QCoreApplication::translate("main", "ms")
+    );
+    parser.addOption(loadDurationOpt);
+
+    QCommandLineOption loadRateOpt(
+        LoadRateOptStr,
+        QCoreApplication::translate("main", "Target rate (messages per second) of the load "
+                                            "generation. Default is 0, which means as "
+                                            "fast as possible."),
+        QCoreApplication::translate("main", "num")
+    );
+    parser.addOption(loadRateOpt);
+
+    QCommandLineOption loadConnectionsOpt(
+        LoadConnectionsOptStr,
+        QCoreApplication::translate("main", "Number of socket connections the load is spread "
+                                            "across. Requires socket plugin creating separate "
+                                            "socket for every connection. Default is 1."),
+        QCoreApplication::translate("main", "num")
+    );
+    parser.addOption(loadConnectionsOpt);
+
+    QCommandLineOption latencyStatsOpt(
+        LatencyStatsOptStr,
+        QCoreApplication::translate("main", "Measure latency of the receive pipeline stages "
+                                            "and report it every second.")
+    );
+    parser.addOption(latencyStatsOpt);
 }
 
 QString getRootDir()
@@ -196,6 +294,75 @@ int main(int argc, char *argv[])
         config.m_quiet = true;
     }
 
+    if (parser.isSet(QuitOnDisconnectOptStr)) {
+        config.m_quitOnDisconnect = true;
+    }
+
+    if (parser.isSet(CaptureOptStr)) {
+        config.m_captureFile = parser.value(CaptureOptStr);
+    }
+
+    if (parser.isSet(ThreadsOptStr)) {
+        auto valuesList = parser.value(ThreadsOptStr).split(',', QString::SkipEmptyParts);
+        for (auto& valueStr : valuesList) {
+            bool ok = false;
+            unsigned value = valueStr.trimmed().toUInt(&ok);
+            if (ok) {
+                config.m_parseThreads.push_back(value);
+            }
+        }
+    }
+
+    if (parser.isSet(ParseBenchmarkOptStr)) {
+        config.m_parseBenchmark = true;
+    }
+
+    if (parser.isSet(RecordCommitOptStr)) {
+        auto valueStr = parser.value(RecordCommitOptStr);
+        bool ok = false;
+        unsigned value = valueStr.toUInt(&ok);
+        if ((!ok) || (value == 0U)) {
+            std::cerr << "ERROR: Invalid value of \"--" <<
+                RecordCommitOptStr.toStdString() <<
+                "\" option, expected positive number of milliseconds." << std::endl;
+            return -1;
+        }
+
+        config.m_recordCommitInterval = value;
+    }
+
+    if (parser.isSet(ColumnarOptStr)) {
+        config.m_columnarFile = parser.value(ColumnarOptStr);
+    }
+
+    if (parser.isSet(LatencyStatsOptStr)) {
+        config.m_latencyStats = true;
+    }
+
+    if (parser.isSet(LoadDurationOptStr)) {
+        bool ok = false;
+        unsigned value = parser.value(LoadDurationOptStr).toUInt(&ok);
+        if (ok) {
+            config.m_loadDuration = value;
+        }
+    }
+
+    if (parser.isSet(LoadRateOptStr)) {
+        bool ok = false;
+        unsigned value = parser.value(LoadRateOptStr).toUInt(&ok);
+        if (ok) {
+            config.m_loadRate = value;
+        }
+    }
+
+    if (parser.isSet(LoadConnectionsOptStr)) {
+        bool ok = false;
+        unsigned value = parser.value(LoadConnectionsOptStr).toUInt(&ok);
+        if (ok && (0U < value)) {
+            config.m_loadConnections = value;
+        }
+    }
+
     comms_dump::AppMgr appMgr;
     if (!appMgr.start(config)) {
         std::cerr << "Failed to start!" << std::endl;
@@ -18,6 +18,8 @@
 #include "DefaultMessageDisplayHandler.h"
 
 #include <cassert>
+#include <algorithm>
+#include <typeinfo>
 
 #include <QtWidgets/QApplication>
 
@@ -134,20 +136,21 @@ public:
     virtual void handle(field_wrapper::ArrayListWrapper& wrapper) override
     {
         auto createMembersWidgetsFunc =
-            [](field_wrapper::ArrayListWrapper& wrap) -> std::vector<FieldWidgetPtr>
+            [](field_wrapper::ArrayListWrapper& wrap, unsigned fromIdx, unsigned count) -> std::vector<FieldWidgetPtr>
             {
                 std::vector<FieldWidgetPtr> allFieldsWidgets;
                 WidgetCreator otherCreator;
                 auto& memWrappers = wrap.getMembers();
-                allFieldsWidgets.reserve(memWrappers.size());
                 assert(memWrappers.size() == wrap.size());
+                assert((fromIdx + count) <= memWrappers.size());
 
-                for (auto& memWrap : memWrappers) {
-                    memWrap->dispatch(otherCreator);
+                allFieldsWidgets.reserve(count);
+                for (auto idx = fromIdx; idx < (fromIdx + count); ++idx) {
+                    memWrappers[idx]->dispatch(otherCreator);
                     allFieldsWidgets.push_back(otherCreator.getWidget());
                 }
 
-                assert(allFieldsWidgets.size() == wrap.size());
+                assert(allFieldsWidgets.size() == count);
                 return allFieldsWidgets;
             };
 
@@ -215,27 +218,96 @@ private:
 
 }  // namespace
 
+const std::size_t DefaultMessageDisplayHandler::MaxCachedWidgets;
+
 DefaultMessageDisplayHandler::~DefaultMessageDisplayHandler() = default;
 
-DefaultMessageDisplayHandler::MsgWidgetPtr DefaultMessageDisplayHandler::getMsgWidget()
+MessageWidget* DefaultMessageDisplayHandler::getMsgWidget()
 {
-    return std::move(m_widget);
+    return m_widget;
 }
 
 void DefaultMessageDisplayHandler::beginMsgHandlingImpl(
     Message& msg)
 {
-    m_widget.reset(new DefaultMessageWidget(msg));
+    m_msg = &msg;
+    m_widget = nullptr;
+    m_wrappers.clear();
 }
 
 void DefaultMessageDisplayHandler::addFieldImpl(FieldWrapperPtr wrapper)
 {
-    assert(m_widget);
-    WidgetCreator creator;
-    wrapper->dispatch(creator);
-    auto fieldWidget = creator.getWidget();
-    fieldWidget->hide();
-    m_widget->addFieldWidget(fieldWidget.release());
+    assert(wrapper);
+    m_wrappers.push_back(std::move(wrapper));
+}
+
+void DefaultMessageDisplayHandler::endMsgHandlingImpl()
+{
+    assert(m_msg != nullptr);
+    std::type_index msgType(typeid(*m_msg));
+    auto iter =
+        std::find_if(
+            m_cache.begin(), m_cache.end(),
+            [&msgType](const CachedWidget& cached) -> bool
+            {
+                return cached.m_type == msgType;
+            });
+
+    do {
+        if (iter == m_cache.end()) {
+            m_cache.emplace_front(msgType);
+            createWidget(m_cache.front());
+            break;
+        }
+
+        m_cache.splice(m_cache.begin(), m_cache, iter);
+        if (rebindCached(m_cache.front())) {
+            break;
+        }
+
+        createWidget(m_cache.front());
+    } while (false);
+
+    m_widget = m_cache.front().m_widget.get();
+    m_wrappers.clear();
+    m_msg = nullptr;
+
+    while (MaxCachedWidgets < m_cache.size()) {
+        m_cache.pop_back();
+    }
+}
+
+bool DefaultMessageDisplayHandler::rebindCached(CachedWidget& cached)
+{
+    assert(cached.m_widget);
+    if (cached.m_fields.size() != m_wrappers.size()) {
+        return false;
+    }
+
+    for (auto idx = 0U; idx < m_wrappers.size(); ++idx) {
+        assert(cached.m_fields[idx] != nullptr);
+        if (!cached.m_fields[idx]->rebind(*m_wrappers[idx])) {
+            return false;
+        }
+    }
+
+    cached.m_widget->refresh();
+    return true;
+}
+
+void DefaultMessageDisplayHandler::createWidget(CachedWidget& cached)
+{
+    assert(m_msg != nullptr);
+    cached.m_fields.clear();
+    cached.m_widget.reset(new DefaultMessageWidget(*m_msg));
+    for (auto& wrapper : m_wrappers) {
+        WidgetCreator creator;
+        wrapper->dispatch(creator);
+        auto fieldWidget = creator.getWidget();
+        fieldWidget->hide();
+        cached.m_fields.push_back(fieldWidget.get());
+        cached.m_widget->addFieldWidget(fieldWidget.release());
+    }
 }
 
 }  // namespace comms_champion
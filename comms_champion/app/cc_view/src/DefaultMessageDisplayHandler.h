@@ -20,6 +20,9 @@
 
 #include <cassert>
 #include <type_traits>
+#include <typeindex>
+#include <list>
+#include <vector>
 
 #include "comms/CompileControl.h"
 
@@ -36,24 +39,52 @@ CC_ENABLE_WARNINGS()
 namespace comms_champion
 {
 
+/// @brief Creates widgets displaying messages.
+/// @details The created widgets are cached per message type and are owned
+///     by the handler. When a message of already seen type is handled,
+///     the cached widget tree is rebound to the fields of the new message
+///     object and refreshed instead of being created from scratch.
 class DefaultMessageDisplayHandler : public MessageHandler
 {
 public:
-    using MsgWidgetPtr = std::unique_ptr<MessageWidget>;
-
     ~DefaultMessageDisplayHandler();
 
-    MsgWidgetPtr getMsgWidget();
+    /// @brief Get widget of the last handled message.
+    /// @details The widget remains owned by the handler and may be reused
+    ///     for the next message of the same type.
+    MessageWidget* getMsgWidget();
 
 protected:
 
     virtual void beginMsgHandlingImpl(Message& msg) override;
     virtual void addFieldImpl(FieldWrapperPtr wrapper) override;
+    virtual void endMsgHandlingImpl() override;
 
 private:
-
     using DefaultMsgWidgetPtr = std::unique_ptr<DefaultMessageWidget>;
-    DefaultMsgWidgetPtr m_widget;
+    using FieldWidgetsList = std::vector<FieldWidget*>;
+    using FieldWrappersList = std::vector<FieldWrapperPtr>;
+
+    struct CachedWidget
+    {
+        CachedWidget(const std::type_index& type) : m_type(type) {}
+
+        std::type_index m_type;
+        DefaultMsgWidgetPtr m_widget;
+        FieldWidgetsList m_fields;
+    };
+
+    using CachedWidgetsList = std::list<CachedWidget>;
+
+    static const std::size_t MaxCachedWidgets = 32U;
+
+    bool rebindCached(CachedWidget& cached);
+    void createWidget(CachedWidget& cached);
+
+    CachedWidgetsList m_cache; // Most recently used first
+    FieldWrappersList m_wrappers;
+    Message* m_msg = nullptr;
+    MessageWidget* m_widget = nullptr;
 };
 
 }  // namespace comms_champion
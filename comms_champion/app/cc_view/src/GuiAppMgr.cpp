@@ -30,6 +30,7 @@ CC_DISABLE_WARNINGS()
 CC_ENABLE_WARNINGS()
 
 #include "comms_champion/property/message.h"
+#include "comms_champion/property/field.h"
 #include "DefaultMessageDisplayHandler.h"
 #include "PluginMgrG.h"
 #include "MsgFileMgrG.h"
@@ -163,6 +164,30 @@ void GuiAppMgr::recvShowGarbageToggled(bool checked)
     updateRecvListMode(RecvListMode_ShowGarbage, checked);
 }
 
+void GuiAppMgr::recvFilterChanged(const QString& filter)
+{
+    MsgMgr::MsgsQuery query;
+    auto error = parseRecvFilter(filter, query);
+    emit sigRecvFilterErrorReport(error);
+    if (!error.isEmpty()) {
+        // Keep displaying the messages of the last valid filter
+        return;
+    }
+
+    bool active = !query.m_id.isEmpty();
+    if ((active == m_recvFilterActive) &&
+        ((!active) ||
+         ((query.m_id == m_recvFilter.m_id) &&
+          (query.m_fieldIdx == m_recvFilter.m_fieldIdx) &&
+          (query.m_fieldValue == m_recvFilter.m_fieldValue)))) {
+        return;
+    }
+
+    m_recvFilter = std::move(query);
+    m_recvFilterActive = active;
+    refreshRecvList();
+}
+
 void GuiAppMgr::sendStartClicked()
 {
     m_sendState = SendState::SendingSingle;
@@ -342,6 +367,23 @@ bool GuiAppMgr::recvListEmpty() const
     return m_recvListCount == 0;
 }
 
+void GuiAppMgr::setRecvRefreshRate(unsigned hz)
+{
+    static const unsigned MillisecsInSec = 1000U;
+    if ((hz == 0U) || (MillisecsInSec < hz)) {
+        assert(!"Invalid refresh rate");
+        return;
+    }
+
+    m_recvRefreshInterval = static_cast<int>(MillisecsInSec / hz);
+}
+
+void GuiAppMgr::setLatencyStatsEnabled(bool enabled)
+{
+    m_latencyStatsEnabled = enabled;
+    MsgMgrG::instanceRef().setLatencyStatsEnabled(enabled);
+}
+
 void GuiAppMgr::recvLoadMsgsFromFile(const QString& filename)
 {
     auto& msgMgr = MsgMgrG::instanceRef();
@@ -532,6 +574,7 @@ bool GuiAppMgr::applyNewPlugins(const ListOfPluginInfos& plugins)
         SocketPtr m_socket;
         ListOfFilters m_filters;
         ProtocolPtr m_protocol;
+        Plugin* m_protocolPlugin = nullptr;
         ListOfGuiActions m_actions;
     };
 
@@ -551,6 +594,11 @@ bool GuiAppMgr::applyNewPlugins(const ListOfPluginInfos& plugins)
 
         if (!applyInfo.m_protocol) {
             applyInfo.m_protocol = plugin->createProtocol();
+            if (applyInfo.m_protocol) {
+                // Separate instances are used to decode incoming data in
+                // the worker threads.
+                applyInfo.m_protocolPlugin = plugin;
+            }
         }
 
         auto guiActions = plugin->createGuiActions();
@@ -581,9 +629,19 @@ bool GuiAppMgr::applyNewPlugins(const ListOfPluginInfos& plugins)
         msgMgr.addFilter(std::move(filter));
     }
 
+    if (applyInfo.m_protocolPlugin != nullptr) {
+        auto* protocolPlugin = applyInfo.m_protocolPlugin;
+        msgMgr.setDecodeProtocolCreateFunc(
+            [protocolPlugin]() -> ProtocolPtr
+            {
+                return protocolPlugin->createProtocol();
+            });
+    }
+
     msgMgr.setProtocol(std::move(applyInfo.m_protocol));
 
     msgMgr.start();
+    m_decodeStatsTimer.start();
     emit sigActivityStateChanged((int)ActivityState::Active);
 
     for (auto& action : applyInfo.m_actions) {
@@ -614,6 +672,21 @@ GuiAppMgr::GuiAppMgr(QObject* parentObj)
         &m_pendingDisplayTimer, SIGNAL(timeout()),
         this, SLOT(pendingDisplayTimeout()));
 
+    static const unsigned DefaultRecvRefreshRate = 30U;
+    setRecvRefreshRate(DefaultRecvRefreshRate);
+    m_recvRefreshTimer.setSingleShot(true);
+
+    connect(
+        &m_recvRefreshTimer, SIGNAL(timeout()),
+        this, SLOT(recvRefreshTimeout()));
+
+    static const int DecodeStatsInterval = 1000;
+    m_decodeStatsTimer.setInterval(DecodeStatsInterval);
+
+    connect(
+        &m_decodeStatsTimer, SIGNAL(timeout()),
+        this, SLOT(decodeStatsTimeout()));
+
     m_sendMgr.setSendMsgsCallbackFunc(
         [this](MessagesList&& msgsToSend)
         {
@@ -679,22 +752,53 @@ void GuiAppMgr::msgAdded(MessagePtr msg)
         return;
     }
 
-    addMsgToRecvList(msg);
+    if (m_recvFilterActive && (!MsgMgr::msgMatches(*msg, m_recvFilter))) {
+        return;
+    }
 
-    if (m_clickedMsg) {
+    m_pendingRecvMsgs.push_back(std::move(msg));
+    if (!m_recvRefreshTimer.isActive()) {
+        m_recvRefreshTimer.start(m_recvRefreshInterval);
+    }
+}
+
+void GuiAppMgr::decodeStatsTimeout()
+{
+    auto& msgMgr = MsgMgrG::instanceRef();
+    auto stats = msgMgr.getDecodeStats();
+    if ((!stats.m_threaded) && (!m_latencyStatsEnabled)) {
+        m_decodeStatsTimer.stop();
         return;
     }
 
-    if (m_pendingDisplayWaitInProgress) {
-        m_pendingDisplayMsg = std::move(msg);
+    if (stats.m_threaded) {
+        emit sigRecvDecodeStatsReport(
+            static_cast<unsigned>(stats.m_queued),
+            static_cast<unsigned>(stats.m_droppedData));
+    }
+
+    if (!m_latencyStatsEnabled) {
         return;
     }
 
-    displayMessage(std::move(msg));
+    auto latencyStats = msgMgr.getLatencyStats();
+    msgMgr.resetLatencyStats();
 
-    static const int DisplayTimeout = 250;
-    m_pendingDisplayWaitInProgress = true;
-    m_pendingDisplayTimer.start(DisplayTimeout);
+    QString report;
+    for (unsigned idx = 0U; idx < latencyStats.size(); ++idx) {
+        auto& hist = latencyStats[idx];
+        if (!report.isEmpty()) {
+            report.append(", ");
+        }
+
+        report.append(
+            tr("%1: %2/%3 us").arg(
+                MsgMgr::latencyStageName(static_cast<MsgMgr::LatencyStage>(idx))).arg(
+                static_cast<qulonglong>(hist.valueAtPercentile(50.0))).arg(
+                static_cast<qulonglong>(hist.valueAtPercentile(99.0))));
+    }
+
+    emit sigRecvLatencyStatsReport(tr("Latency p50/p99 - ") + report);
 }
 
 void GuiAppMgr::errorReported(const QString& msg)
@@ -715,6 +819,18 @@ void GuiAppMgr::pendingDisplayTimeout()
     }
 }
 
+void GuiAppMgr::recvRefreshTimeout()
+{
+    if (m_pendingRecvMsgs.empty()) {
+        return;
+    }
+
+    auto lastMsg = m_pendingRecvMsgs.back();
+    addMsgsToRecvList(std::move(m_pendingRecvMsgs));
+    m_pendingRecvMsgs.clear();
+    displayLatestMessage(std::move(lastMsg));
+}
+
 void GuiAppMgr::msgClicked(MessagePtr msg, SelectionType selType)
 {
     assert(msg);
@@ -759,35 +875,74 @@ void GuiAppMgr::refreshRecvList()
 
     clearRecvList(false);
 
-    auto& allMsgs = MsgMgrG::instanceRef().getAllMsgs();
+    MessagesList msgsToAdd;
+    int clickedIdx = -1;
+    auto& msgMgr = MsgMgrG::instanceRef();
+    MsgMgr::AllMessages filteredMsgs;
+    if (m_recvFilterActive) {
+        filteredMsgs = msgMgr.findMsgs(m_recvFilter);
+    }
+
+    auto& allMsgs = m_recvFilterActive ? filteredMsgs : msgMgr.getAllMsgs();
     for (auto& msg : allMsgs) {
         assert(msg);
         auto type = property::message::Type().getFrom(*msg);
 
         if (canAddToRecvList(*msg, type)) {
-            addMsgToRecvList(msg);
             if (msg == clickedMsg) {
-                assert(0 < m_recvListCount);
-                recvMsgClicked(msg, m_recvListCount - 1);
+                clickedIdx = static_cast<int>(m_recvListCount + msgsToAdd.size());
             }
+            msgsToAdd.push_back(msg);
         }
     }
 
+    addMsgsToRecvList(std::move(msgsToAdd));
+    if (0 <= clickedIdx) {
+        recvMsgClicked(clickedMsg, clickedIdx);
+    }
+
     if (!m_clickedMsg) {
         emit sigRecvMsgListClearSelection();
     }
 }
 
-void GuiAppMgr::addMsgToRecvList(MessagePtr msg)
+void GuiAppMgr::addMsgsToRecvList(MessagesList&& msgs)
 {
-    assert(msg);
-    ++m_recvListCount;
+    if (msgs.empty()) {
+        return;
+    }
+
+    m_recvListCount += static_cast<unsigned>(msgs.size());
     emit sigRecvListCountReport(m_recvListCount);
-    emit sigAddRecvMsg(msg);
+    emit sigAddRecvMsgs(msgs);
+}
+
+void GuiAppMgr::displayLatestMessage(MessagePtr msg)
+{
+    if (m_clickedMsg) {
+        return;
+    }
+
+    if (m_pendingDisplayWaitInProgress) {
+        m_pendingDisplayMsg = std::move(msg);
+        return;
+    }
+
+    displayMessage(std::move(msg));
+
+    static const int DisplayTimeout = 250;
+    m_pendingDisplayWaitInProgress = true;
+    m_pendingDisplayTimer.start(DisplayTimeout);
 }
 
 void GuiAppMgr::clearRecvList(bool reportDeleted)
 {
+    m_recvRefreshTimer.stop();
+    if (reportDeleted && (!m_pendingRecvMsgs.empty())) {
+        deleteMessages(std::move(m_pendingRecvMsgs));
+    }
+    m_pendingRecvMsgs.clear();
+
     bool wasSelected = (m_selType == SelectionType::Recv);
     bool sendSelected = (m_selType == SelectionType::Send);
     assert((!wasSelected) || (m_clickedMsg));
@@ -825,6 +980,80 @@ bool GuiAppMgr::canAddToRecvList(
     return recvListShowsGarbage();
 }
 
+QString GuiAppMgr::parseRecvFilter(
+    const QString& filter,
+    MsgMgr::MsgsQuery& query) const
+{
+    auto tokens = filter.split(QChar(' '), QString::SkipEmptyParts);
+    if (tokens.isEmpty()) {
+        return QString();
+    }
+
+    query.m_id = tokens.front();
+    if (tokens.size() < 2) {
+        return QString();
+    }
+
+    auto fieldTokens = tokens.mid(1).join(QChar(' ')).split(QChar('='));
+    if (fieldTokens.size() != 2) {
+        static const QString Error(tr("Expected FIELD=VALUE after message ID"));
+        return Error;
+    }
+
+    auto fieldName = fieldTokens[0].trimmed();
+    query.m_fieldValue = fieldTokens[1].trimmed();
+    if (fieldName.isEmpty()) {
+        static const QString Error(tr("Missing field name or index"));
+        return Error;
+    }
+
+    bool isIdx = false;
+    auto fieldIdx = fieldName.toInt(&isIdx);
+    if (isIdx && (fieldIdx < 0)) {
+        static const QString Error(tr("Invalid field index"));
+        return Error;
+    }
+
+    auto protocol = MsgMgrG::instanceRef().getProtocol();
+    MessagePtr msg;
+    if (protocol) {
+        msg = protocol->createMessage(query.m_id);
+    }
+
+    if (!msg) {
+        if (isIdx) {
+            // The index can't be verified, the filter matches nothing when
+            // the message doesn't exist.
+            query.m_fieldIdx = fieldIdx;
+            return QString();
+        }
+
+        static const QString Error(tr("Unknown message ID, field can't be found by name"));
+        return Error;
+    }
+
+    auto& fieldsProps = msg->fieldsProperties();
+    if (isIdx) {
+        if (fieldsProps.size() <= fieldIdx) {
+            static const QString Error(tr("Field index is out of range"));
+            return Error;
+        }
+
+        query.m_fieldIdx = fieldIdx;
+        return QString();
+    }
+
+    for (auto idx = 0; idx < fieldsProps.size(); ++idx) {
+        if (property::field::Common(fieldsProps[idx]).name() == fieldName) {
+            query.m_fieldIdx = idx;
+            return QString();
+        }
+    }
+
+    static const QString Error(tr("Unknown field name"));
+    return Error;
+}
+
 void GuiAppMgr::decRecvListCount()
 {
     --m_recvListCount;
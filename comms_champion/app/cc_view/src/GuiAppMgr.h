@@ -93,6 +93,8 @@ public:
     bool recvListShowsSent() const;
     bool recvListShowsGarbage() const;
     unsigned recvListModeMask() const;
+    void setRecvRefreshRate(unsigned hz);
+    void setLatencyStatsEnabled(bool enabled);
 
     SendState sendState() const;
     void sendAddNewMessage(MessagePtr msg);
@@ -120,6 +122,7 @@ public slots:
     void recvShowRecvToggled(bool checked);
     void recvShowSentToggled(bool checked);
     void recvShowGarbageToggled(bool checked);
+    void recvFilterChanged(const QString& filter);
 
     void sendStartClicked();
     void sendStartAllClicked();
@@ -148,7 +151,7 @@ public slots:
     void disconnectSocketClicked();
 
 signals:
-    void sigAddRecvMsg(MessagePtr msg);
+    void sigAddRecvMsgs(const MessagesList& msgs);
     void sigAddSendMsg(MessagePtr msg);
     void sigSendMsgUpdated(MessagePtr msg);
     void sigSetRecvState(int state);
@@ -172,6 +175,9 @@ signals:
     void sigSendMoveSelectedDown();
     void sigSendMoveSelectedBottom();
     void sigRecvListTitleNeedsUpdate();
+    void sigRecvDecodeStatsReport(unsigned queued, unsigned dropped);
+    void sigRecvLatencyStatsReport(const QString& report);
+    void sigRecvFilterErrorReport(const QString& error);
     void sigNewSendMsgDialog(ProtocolPtr protocol);
     void sigSendRawMsgDialog(ProtocolPtr protocol);
     void sigUpdateSendMsgDialog(MessagePtr msg, ProtocolPtr protocol);
@@ -207,6 +213,8 @@ private slots:
     void errorReported(const QString& msg);
     void socketDisconnected();
     void pendingDisplayTimeout();
+    void recvRefreshTimeout();
+    void decodeStatsTimeout();
 
 private /*data*/:
 
@@ -214,9 +222,11 @@ private /*data*/:
     void displayMessage(MessagePtr msg);
     void clearDisplayedMessage();
     void refreshRecvList();
-    void addMsgToRecvList(MessagePtr msg);
+    void addMsgsToRecvList(MessagesList&& msgs);
+    void displayLatestMessage(MessagePtr msg);
     void clearRecvList(bool reportDeleted);
     bool canAddToRecvList(const Message& msg, MsgType type) const;
+    QString parseRecvFilter(const QString& filter, MsgMgr::MsgsQuery& query) const;
     void decRecvListCount();
     void decSendListCount();
     void emitRecvNotSelected();
@@ -230,6 +240,8 @@ private /*data*/:
         RecvListMode_ShowReceived |
         RecvListMode_ShowSent |
         RecvListMode_ShowGarbage;
+    MsgMgr::MsgsQuery m_recvFilter;
+    bool m_recvFilterActive = false;
 
     SendState m_sendState;
     unsigned m_sendListCount = 0;
@@ -241,6 +253,13 @@ private /*data*/:
     MessagePtr m_pendingDisplayMsg;
     bool m_pendingDisplayWaitInProgress = false;
 
+    QTimer m_recvRefreshTimer;
+    MessagesList m_pendingRecvMsgs;
+    int m_recvRefreshInterval = 0;
+
+    QTimer m_decodeStatsTimer;
+    bool m_latencyStatsEnabled = false;
+
     MsgSendMgr m_sendMgr;
 };
 
@@ -43,6 +43,8 @@ namespace
 const QString CleanOptStr("clean");
 const QString ConfigOptStr("config");
 const QString PluginsOptStr("plugins");
+const QString RefreshRateOptStr("refresh-rate");
+const QString LatencyStatsOptStr("latency-stats");
 
 void metaTypesRegisterAll()
 {
@@ -84,6 +86,21 @@ void prepareCommandLineOptions(QCommandLineParser& parser)
         QCoreApplication::translate("main", "filename")
     );
     parser.addOption(pluginsOpt);
+
+    QCommandLineOption refreshRateOpt(
+        QStringList() << "r" << RefreshRateOptStr,
+        QCoreApplication::translate("main", "Refresh rate (in Hz) of the received messages list. "
+                                            "Default is 30."),
+        QCoreApplication::translate("main", "hz")
+    );
+    parser.addOption(refreshRateOpt);
+
+    QCommandLineOption latencyStatsOpt(
+        LatencyStatsOptStr,
+        QCoreApplication::translate("main", "Measure latency of the receive pipeline stages "
+                                            "and show it in the status bar.")
+    );
+    parser.addOption(latencyStatsOpt);
 }
 
 }  // namespace
@@ -114,6 +131,21 @@ int main(int argc, char *argv[])
     pluginMgr.setPluginsDir(pluginsDir);
 
     auto& guiAppMgr = cc::GuiAppMgr::instanceRef();
+    if (parser.isSet(RefreshRateOptStr)) {
+        bool ok = false;
+        unsigned refreshRate = parser.value(RefreshRateOptStr).toUInt(&ok);
+        if (ok && (0U < refreshRate) && (refreshRate <= 1000U)) {
+            guiAppMgr.setRecvRefreshRate(refreshRate);
+        }
+        else {
+            std::cerr << "WARNING: Invalid refresh rate, using default one" << std::endl;
+        }
+    }
+
+    if (parser.isSet(LatencyStatsOptStr)) {
+        guiAppMgr.setLatencyStatsEnabled(true);
+    }
+
     do {
         if (parser.isSet(CleanOptStr) && guiAppMgr.startClean()) {
             break;
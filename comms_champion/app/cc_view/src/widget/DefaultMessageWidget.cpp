@@ -35,7 +35,7 @@ DefaultMessageWidget::DefaultMessageWidget(
     Message& msg,
     QWidget* parentObj)
   : Base(parentObj),
-    m_msg(msg),
+    m_fieldsProps(msg.fieldsProperties()),
     m_layout(new LayoutType())
 {
     setLayout(m_layout);
@@ -51,7 +51,7 @@ void DefaultMessageWidget::addFieldWidget(FieldWidget* field)
         return;
     }
 
-    auto& props = m_msg.fieldsProperties();
+    auto& props = m_fieldsProps;
     if (m_curFieldIdx < static_cast<decltype(m_curFieldIdx)>(props.size())) {
         auto& propsMapVar = props.at(m_curFieldIdx);
         if (propsMapVar.isValid() && propsMapVar.canConvert<QVariantMap>()) {
@@ -58,7 +58,7 @@ private:
     void connectFieldSignals(FieldWidget* field);
 
     using LayoutType = QVBoxLayout;
-    Message& m_msg;
+    QVariantList m_fieldsProps;
     LayoutType* m_layout;
     uint m_curFieldIdx = 0;
 };
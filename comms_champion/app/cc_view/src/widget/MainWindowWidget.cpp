@@ -26,6 +26,8 @@ CC_DISABLE_WARNINGS()
 #include <QtWidgets/QShortcut>
 #include <QtWidgets/QFileDialog>
 #include <QtWidgets/QMessageBox>
+#include <QtWidgets/QStatusBar>
+#include <QtWidgets/QLabel>
 #include <QtGui/QIcon>
 #include <QtGui/QKeySequence>
 CC_ENABLE_WARNINGS()
@@ -89,6 +91,12 @@ MainWindowWidget::MainWindowWidget(QWidget* parentObj)
     connect(
         guiAppMgr, SIGNAL(sigActivityStateChanged(int)),
         this, SLOT(activeStateChanged(int)));
+    connect(
+        guiAppMgr, SIGNAL(sigRecvDecodeStatsReport(unsigned, unsigned)),
+        this, SLOT(recvDecodeStatsReport(unsigned, unsigned)));
+    connect(
+        guiAppMgr, SIGNAL(sigRecvLatencyStatsReport(const QString&)),
+        this, SLOT(recvLatencyStatsReport(const QString&)));
     connect(
         guiAppMgr, SIGNAL(sigLoadRecvMsgsDialog()),
         this, SLOT(loadRecvMsgsDialog()));
@@ -205,6 +213,22 @@ void MainWindowWidget::activeStateChanged(int state)
     }
 }
 
+void MainWindowWidget::recvDecodeStatsReport(unsigned queued, unsigned dropped)
+{
+    statusBar()->showMessage(
+        tr("Decode queue: %1, dropped: %2").arg(queued).arg(dropped));
+}
+
+void MainWindowWidget::recvLatencyStatsReport(const QString& report)
+{
+    if (m_latencyLabel == nullptr) {
+        m_latencyLabel = new QLabel();
+        statusBar()->addPermanentWidget(m_latencyLabel);
+    }
+
+    m_latencyLabel->setText(report);
+}
+
 void MainWindowWidget::loadRecvMsgsDialog()
 {
     auto result = loadMsgsDialog(false);
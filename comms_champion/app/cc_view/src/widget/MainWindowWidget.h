@@ -26,6 +26,7 @@
 CC_DISABLE_WARNINGS()
 #include <QtWidgets/QMainWindow>
 #include <QtWidgets/QToolBar>
+#include <QtWidgets/QLabel>
 
 #include "ui_MainWindowWidget.h"
 CC_ENABLE_WARNINGS()
@@ -57,6 +58,8 @@ private slots:
     void addMainToolbarAction(ActionPtr action);
     void clearAllMainToolbarActions();
     void activeStateChanged(int state);
+    void recvDecodeStatsReport(unsigned queued, unsigned dropped);
+    void recvLatencyStatsReport(const QString& report);
     void loadRecvMsgsDialog();
     void saveRecvMsgsDialog();
     void loadSendMsgsDialog(bool askForClear);
@@ -71,6 +74,7 @@ private:
     Ui::MainWindowWidget m_ui;
     QToolBar* m_toolbar = nullptr;
     std::list<ActionPtr> m_customActions;
+    QLabel* m_latencyLabel = nullptr;
 };
 
 }  // namespace comms_champion
@@ -493,6 +493,9 @@ void MessageUpdateDialog::accept()
 
     property::message::ScrollPos().setTo(m_origScrollPos, *msg);
 
+    // Edited message must not reuse previously serialised frames
+    property::message::FrameCacheKey().setTo(0U, *msg);
+
     m_msg = std::move(msg);
     assert(m_msg);
     Base::accept();
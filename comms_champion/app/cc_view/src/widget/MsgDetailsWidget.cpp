@@ -51,6 +51,11 @@ MsgDetailsWidget::MsgDetailsWidget(QWidget* parentObj)
         this, SLOT(widgetScrolled(int)));
 }
 
+MsgDetailsWidget::~MsgDetailsWidget()
+{
+    releaseDisplayedWidget();
+}
+
 void MsgDetailsWidget::setEditEnabled(bool enabled)
 {
     m_editEnabled = enabled;
@@ -62,21 +67,23 @@ void MsgDetailsWidget::setEditEnabled(bool enabled)
 void MsgDetailsWidget::displayMessage(MessagePtr msg)
 {
     assert(msg);
+    releaseDisplayedWidget();
     msg->dispatch(m_msgDisplayHandler);
-    auto msgWidget = m_msgDisplayHandler.getMsgWidget();
-    assert(msgWidget);
+    auto* msgWidget = m_msgDisplayHandler.getMsgWidget();
+    assert(msgWidget != nullptr);
     msgWidget->setEditEnabled(m_editEnabled);
 
     connect(
-        msgWidget.get(), SIGNAL(sigMsgUpdated()),
-        this, SIGNAL(sigMsgUpdated()));
+        msgWidget, SIGNAL(sigMsgUpdated()),
+        this, SIGNAL(sigMsgUpdated()),
+        Qt::UniqueConnection);
 
-    m_displayedMsgWidget = msgWidget.get();
+    m_displayedMsgWidget = msgWidget;
 
     auto* scrollBar = m_ui.m_scrollArea->verticalScrollBar();
     assert(scrollBar != nullptr);
     scrollBar->blockSignals(true);
-    m_ui.m_scrollArea->setWidget(msgWidget.release());
+    m_ui.m_scrollArea->setWidget(msgWidget);
     m_displayedMsgWidget->show();
     scrollBar->blockSignals(false);
 
@@ -101,8 +108,7 @@ void MsgDetailsWidget::updateTitle(MessagePtr msg)
 
 void MsgDetailsWidget::clear()
 {
-    delete m_displayedMsgWidget;
-    m_displayedMsgWidget = nullptr;
+    releaseDisplayedWidget();
     m_displayedMsg.reset();
     m_ui.m_scrollArea->setWidget(new QWidget());
     m_ui.m_groupBox->setTitle(getTitlePrefix());
@@ -115,6 +121,25 @@ void MsgDetailsWidget::refresh()
     }
 }
 
+void MsgDetailsWidget::releaseDisplayedWidget()
+{
+    if (m_displayedMsgWidget == nullptr) {
+        return;
+    }
+
+    // The widget is owned by the display handler, prevent its
+    // destruction by the scroll area.
+    auto* scrollBar = m_ui.m_scrollArea->verticalScrollBar();
+    assert(scrollBar != nullptr);
+    scrollBar->blockSignals(true);
+    auto* widget = m_ui.m_scrollArea->takeWidget();
+    scrollBar->blockSignals(false);
+    static_cast<void>(widget);
+    assert(widget == m_displayedMsgWidget);
+    m_displayedMsgWidget->hide();
+    m_displayedMsgWidget = nullptr;
+}
+
 void MsgDetailsWidget::widgetScrolled(int value)
 {
     if (m_displayedMsg == nullptr) {
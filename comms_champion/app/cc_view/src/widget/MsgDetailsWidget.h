@@ -39,6 +39,7 @@ class MsgDetailsWidget: public QWidget
     using Base = QWidget;
 public:
     MsgDetailsWidget(QWidget* parentObj = nullptr);
+    ~MsgDetailsWidget();
 
 public slots:
     void setEditEnabled(bool enabled);
@@ -54,6 +55,8 @@ private slots:
     void widgetScrolled(int value);
 
 private:
+    void releaseDisplayedWidget();
+
     Ui::MsgDetailsWidget m_ui;
     DefaultMessageDisplayHandler m_msgDisplayHandler;
     MessageWidget* m_displayedMsgWidget = nullptr;
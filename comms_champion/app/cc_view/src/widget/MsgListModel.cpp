@@ -0,0 +1,185 @@
+//
+// Copyright 2017 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#include "MsgListModel.h"
+
+#include <cassert>
+#include <iterator>
+
+#include "comms/CompileControl.h"
+
+CC_DISABLE_WARNINGS()
+#include <QtCore/QVariant>
+#include <QtGui/QColor>
+CC_ENABLE_WARNINGS()
+
+namespace comms_champion
+{
+
+MsgListModel::MsgListModel(QObject* parentObj)
+  : Base(parentObj)
+{
+}
+
+MsgListModel::~MsgListModel() = default;
+
+int MsgListModel::rowCount(const QModelIndex& parentIdx) const
+{
+    if (parentIdx.isValid()) {
+        return 0;
+    }
+
+    return count();
+}
+
+QVariant MsgListModel::data(const QModelIndex& idx, int role) const
+{
+    if ((!idx.isValid()) || (count() <= idx.row())) {
+        return QVariant();
+    }
+
+    auto& msg = m_msgs[static_cast<std::size_t>(idx.row())];
+    assert(msg);
+
+    if (role == Qt::DisplayRole) {
+        if (!m_textFunc) {
+            return QString(msg->name());
+        }
+        return m_textFunc(*msg);
+    }
+
+    if (role == Qt::ForegroundRole) {
+        if (!m_colourFunc) {
+            return QVariant();
+        }
+        return QColor(m_colourFunc(*msg));
+    }
+
+    if (role == Qt::ToolTipRole) {
+        if (!m_tooltipFunc) {
+            return QVariant();
+        }
+        return m_tooltipFunc();
+    }
+
+    if (role == Qt::UserRole) {
+        return QVariant::fromValue(msg);
+    }
+
+    return QVariant();
+}
+
+int MsgListModel::count() const
+{
+    return static_cast<int>(m_msgs.size());
+}
+
+MessagePtr MsgListModel::msgAt(int row) const
+{
+    if ((row < 0) || (count() <= row)) {
+        assert(!"Invalid row");
+        return MessagePtr();
+    }
+
+    return m_msgs[static_cast<std::size_t>(row)];
+}
+
+MsgListModel::MessagesList MsgListModel::allMsgs() const
+{
+    return MessagesList(m_msgs.begin(), m_msgs.end());
+}
+
+void MsgListModel::appendMsg(MessagePtr msg)
+{
+    assert(msg);
+    auto row = count();
+    beginInsertRows(QModelIndex(), row, row);
+    m_msgs.push_back(std::move(msg));
+    endInsertRows();
+}
+
+void MsgListModel::appendMsgs(const MessagesList& msgs)
+{
+    if (msgs.empty()) {
+        return;
+    }
+
+    auto first = count();
+    auto last = first + static_cast<int>(msgs.size()) - 1;
+    beginInsertRows(QModelIndex(), first, last);
+    m_msgs.insert(m_msgs.end(), msgs.begin(), msgs.end());
+    endInsertRows();
+}
+
+void MsgListModel::updateMsg(int row, MessagePtr msg)
+{
+    if ((row < 0) || (count() <= row)) {
+        assert(!"Invalid row");
+        return;
+    }
+
+    m_msgs[static_cast<std::size_t>(row)] = std::move(msg);
+    auto modelIdx = index(row);
+    emit dataChanged(modelIdx, modelIdx);
+}
+
+void MsgListModel::removeMsg(int row)
+{
+    if ((row < 0) || (count() <= row)) {
+        assert(!"Invalid row");
+        return;
+    }
+
+    beginRemoveRows(QModelIndex(), row, row);
+    m_msgs.erase(m_msgs.begin() + row);
+    endRemoveRows();
+}
+
+void MsgListModel::moveMsg(int fromRow, int toRow)
+{
+    if ((fromRow < 0) || (count() <= fromRow) ||
+        (toRow < 0) || (count() <= toRow)) {
+        assert(!"Invalid row");
+        return;
+    }
+
+    if (fromRow == toRow) {
+        return;
+    }
+
+    auto destChild = toRow;
+    if (fromRow < toRow) {
+        ++destChild;
+    }
+
+    beginMoveRows(QModelIndex(), fromRow, fromRow, QModelIndex(), destChild);
+    auto msg = std::move(m_msgs[static_cast<std::size_t>(fromRow)]);
+    m_msgs.erase(m_msgs.begin() + fromRow);
+    m_msgs.insert(m_msgs.begin() + toRow, std::move(msg));
+    endMoveRows();
+}
+
+void MsgListModel::clear()
+{
+    beginResetModel();
+    m_msgs.clear();
+    endResetModel();
+}
+
+}  // namespace comms_champion
+
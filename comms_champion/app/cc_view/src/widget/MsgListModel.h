@@ -0,0 +1,98 @@
+//
+// Copyright 2017 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+
+#pragma once
+
+#include <deque>
+#include <functional>
+
+#include "comms/CompileControl.h"
+
+CC_DISABLE_WARNINGS()
+#include <QtCore/QAbstractListModel>
+#include <QtCore/QString>
+#include <QtCore/qnamespace.h>
+CC_ENABLE_WARNINGS()
+
+#include "comms_champion/Message.h"
+#include "comms_champion/Protocol.h"
+
+namespace comms_champion
+{
+
+/// @brief Model of messages history displayed by MsgListWidget.
+/// @details Stores only the message pointers, the displayed text,
+///     colour and tooltip are computed on demand for the visible rows only.
+class MsgListModel : public QAbstractListModel
+{
+    Q_OBJECT
+    using Base = QAbstractListModel;
+public:
+    typedef Protocol::MessagesList MessagesList;
+    typedef std::function<QString (const Message& msg)> TextFunc;
+    typedef std::function<Qt::GlobalColor (const Message& msg)> ColourFunc;
+    typedef std::function<const QString& ()> TooltipFunc;
+
+    explicit MsgListModel(QObject* parentObj = nullptr);
+    ~MsgListModel();
+
+    template <typename TFunc>
+    void setTextFunc(TFunc&& func)
+    {
+        m_textFunc = std::forward<TFunc>(func);
+    }
+
+    template <typename TFunc>
+    void setColourFunc(TFunc&& func)
+    {
+        m_colourFunc = std::forward<TFunc>(func);
+    }
+
+    template <typename TFunc>
+    void setTooltipFunc(TFunc&& func)
+    {
+        m_tooltipFunc = std::forward<TFunc>(func);
+    }
+
+    virtual int rowCount(const QModelIndex& parentIdx = QModelIndex()) const override;
+    virtual QVariant data(const QModelIndex& idx, int role = Qt::DisplayRole) const override;
+
+    int count() const;
+    MessagePtr msgAt(int row) const;
+    MessagesList allMsgs() const;
+
+    void appendMsg(MessagePtr msg);
+    void appendMsgs(const MessagesList& msgs);
+    void updateMsg(int row, MessagePtr msg);
+    void removeMsg(int row);
+    void moveMsg(int fromRow, int toRow);
+    void clear();
+
+private:
+    typedef std::deque<MessagePtr> MsgsStorage;
+
+    MsgsStorage m_msgs;
+    TextFunc m_textFunc;
+    ColourFunc m_colourFunc;
+    TooltipFunc m_tooltipFunc;
+};
+
+}  // namespace comms_champion
+
+
@@ -24,6 +24,8 @@
 CC_DISABLE_WARNINGS()
 #include <QtCore/QVariant>
 #include <QtCore/QDateTime>
+#include <QtCore/QTimer>
+#include <QtCore/QItemSelectionModel>
 CC_ENABLE_WARNINGS()
 
 #include "comms_champion/Message.h"
@@ -48,103 +50,95 @@ MsgListWidget::MsgListWidget(
 {
     m_ui.setupUi(this);
     m_ui.m_groupBoxLayout->insertWidget(0, toolbar);
+
+    m_model.setTextFunc(
+        [this](const Message& msg) -> QString
+        {
+            return getMsgNameText(msg);
+        });
+
+    m_model.setColourFunc(
+        [this](const Message& msg) -> Qt::GlobalColor
+        {
+            return getMsgColour(msg);
+        });
+
+    m_model.setTooltipFunc(
+        [this]() -> const QString&
+        {
+            return msgTooltipImpl();
+        });
+
+    m_ui.m_listView->setModel(&m_model);
+    m_ui.m_listView->setUniformItemSizes(true);
     updateTitle();
 
-    m_ui.m_listWidget->setUniformItemSizes(true);
     connect(
-        m_ui.m_listWidget, SIGNAL(itemClicked(QListWidgetItem*)),
-        this, SLOT(itemClicked(QListWidgetItem*)));
+        m_ui.m_listView, SIGNAL(clicked(const QModelIndex&)),
+        this, SLOT(itemClicked(const QModelIndex&)));
     connect(
-        m_ui.m_listWidget, SIGNAL(currentItemChanged(QListWidgetItem*, QListWidgetItem*)),
-        this, SLOT(currentItemChanged(QListWidgetItem*, QListWidgetItem*)));
+        m_ui.m_listView->selectionModel(), SIGNAL(currentChanged(const QModelIndex&, const QModelIndex&)),
+        this, SLOT(currentItemChanged(const QModelIndex&, const QModelIndex&)));
     connect(
-        m_ui.m_listWidget, SIGNAL(itemDoubleClicked(QListWidgetItem*)),
-        this, SLOT(itemDoubleClicked(QListWidgetItem*)));
+        m_ui.m_listView, SIGNAL(doubleClicked(const QModelIndex&)),
+        this, SLOT(itemDoubleClicked(const QModelIndex&)));
 }
 
 void MsgListWidget::addMessage(MessagePtr msg)
 {
     assert(msg);
-    m_ui.m_listWidget->addItem(getMsgNameText(msg));
-    auto* item = m_ui.m_listWidget->item(m_ui.m_listWidget->count() - 1);
-    item->setToolTip(msgTooltipImpl());
-
-    bool valid = msg->isValid();
+    m_model.appendMsg(std::move(msg));
 
-    auto type = property::message::Type().getFrom(*msg);
-    if ((type != MsgType::Invalid) && (!msg->idAsString().isEmpty())) {
-        item->setForeground(getItemColourImpl(type, valid));
-    }
-    else {
-        item->setForeground(defaultItemColour(valid));
+    if (m_selectOnAdd) {
+        setCurrentRow(m_model.count() - 1);
     }
 
-    item->setData(
-        Qt::UserRole,
-        QVariant::fromValue(msg));
+    scheduleRefresh();
+}
 
-    if (m_selectOnAdd) {
-        m_ui.m_listWidget->blockSignals(true);
-        m_ui.m_listWidget->setCurrentRow(m_ui.m_listWidget->count() - 1);
-        m_ui.m_listWidget->blockSignals(false);
-        assert(m_ui.m_listWidget->currentItem() == item);
+void MsgListWidget::addMessages(const MessagesList& msgs)
+{
+    if (msgs.empty()) {
+        return;
     }
 
-    if (m_ui.m_listWidget->currentRow() < 0) {
-        m_ui.m_listWidget->scrollToBottom();
+    m_model.appendMsgs(msgs);
+
+    if (m_selectOnAdd) {
+        setCurrentRow(m_model.count() - 1);
     }
 
-    updateTitle();
+    scheduleRefresh();
 }
 
 void MsgListWidget::updateCurrentMessage(MessagePtr msg)
 {
-    auto* item = m_ui.m_listWidget->currentItem();
-    if (item == nullptr) {
+    auto row = currentRow();
+    if (row < 0) {
         assert(!"No item is selected for update");
         return;
     }
 
-    item->setData(
-        Qt::UserRole,
-        QVariant::fromValue(msg));
-
-    item->setText(getMsgNameText(msg));
-
-    if ((!msg) || (msg->idAsString().isEmpty())) {
-        item->setForeground(defaultItemColour(false));
-        return;
-    }
-
-    bool valid = msg->isValid();
-
-    auto type = property::message::Type().getFrom(*msg);
-    if (type != MsgType::Invalid) {
-        item->setForeground(getItemColourImpl(type, valid));
-    }
-    else {
-        item->setForeground(defaultItemColour(valid));
-    }
+    m_model.updateMsg(row, std::move(msg));
 }
 
 void MsgListWidget::deleteCurrentMessage()
 {
-    auto* item = m_ui.m_listWidget->currentItem();
-    if (item == nullptr) {
+    auto row = currentRow();
+    if (row < 0) {
         assert(!"No item is selected for deletion");
         return;
     }
 
-    m_ui.m_listWidget->blockSignals(true);
-    delete item; // will remove from the list
-    m_ui.m_listWidget->blockSignals(false);
-
+    m_ignoreCurrentChange = true;
+    m_model.removeMsg(row);
+    m_ignoreCurrentChange = false;
 
     updateTitle();
 
-    auto* nextItem = m_ui.m_listWidget->currentItem();
-    if (nextItem != nullptr) {
-        processClick(nextItem);
+    auto nextIdx = m_ui.m_listView->currentIndex();
+    if (nextIdx.isValid()) {
+        processClick(nextIdx);
     }
 }
 
@@ -155,20 +149,15 @@ void MsgListWidget::selectOnAdd(bool enabled)
 
 void MsgListWidget::clearSelection()
 {
-    m_ui.m_listWidget->clearSelection();
-    m_ui.m_listWidget->setCurrentRow(-1);
+    m_ui.m_listView->clearSelection();
+    setCurrentRow(-1);
 }
 
 void MsgListWidget::clearList(bool reportDeleted)
 {
     MessagesList msgsList;
     if (reportDeleted) {
-        auto count = m_ui.m_listWidget->count();
-        for (auto idx = 0; idx < count; ++idx) {
-            auto* item = m_ui.m_listWidget->item(idx);
-            auto msg = getMsgFromItem(item);
-            msgsList.push_back(std::move(msg));
-        }
+        msgsList = m_model.allMsgs();
     }
 
     clearList();
@@ -180,7 +169,7 @@ void MsgListWidget::clearList(bool reportDeleted)
 
 void MsgListWidget::clearList()
 {
-    m_ui.m_listWidget->clear();
+    m_model.clear();
     updateTitle();
 }
 
@@ -191,7 +180,7 @@ void MsgListWidget::stateChanged(int state)
 
 void MsgListWidget::moveSelectedTop()
 {
-    auto curRow = m_ui.m_listWidget->currentRow();
+    auto curRow = currentRow();
     if (curRow <= 0) {
         assert(!"No item is selected or moving up top item");
         return;
@@ -202,7 +191,7 @@ void MsgListWidget::moveSelectedTop()
 
 void MsgListWidget::moveSelectedUp()
 {
-    auto curRow = m_ui.m_listWidget->currentRow();
+    auto curRow = currentRow();
     if (curRow <= 0) {
         assert(!"No item is selected or moving up top item");
         return;
@@ -213,8 +202,8 @@ void MsgListWidget::moveSelectedUp()
 
 void MsgListWidget::moveSelectedDown()
 {
-    auto curRow = m_ui.m_listWidget->currentRow();
-    if ((m_ui.m_listWidget->count() - 1) <= curRow) {
+    auto curRow = currentRow();
+    if ((m_model.count() - 1) <= curRow) {
         assert(!"No item is selected or moving down bottom item");
         return;
     }
@@ -224,13 +213,13 @@ void MsgListWidget::moveSelectedDown()
 
 void MsgListWidget::moveSelectedBottom()
 {
-    auto curRow = m_ui.m_listWidget->currentRow();
-    if ((m_ui.m_listWidget->count() - 1) <= curRow) {
+    auto curRow = currentRow();
+    if ((m_model.count() - 1) <= curRow) {
         assert(!"No item is selected or moving down bottom item");
         return;
     }
 
-    moveItem(curRow, m_ui.m_listWidget->count() - 1);
+    moveItem(curRow, m_model.count() - 1);
 }
 
 void MsgListWidget::titleNeedsUpdate()
@@ -258,10 +247,8 @@ void MsgListWidget::saveMessages(const QString& filename)
 
 void MsgListWidget::selectMsg(int idx)
 {
-    assert(idx < m_ui.m_listWidget->count());
-    m_ui.m_listWidget->blockSignals(true);
-    m_ui.m_listWidget->setCurrentRow(idx);
-    m_ui.m_listWidget->blockSignals(false);
+    assert(idx < m_model.count());
+    setCurrentRow(idx);
 }
 
 void MsgListWidget::msgClickedImpl(MessagePtr msg, int idx)
@@ -327,27 +314,20 @@ void MsgListWidget::saveMessagesImpl(const QString& filename)
 
 MessagePtr MsgListWidget::currentMsg() const
 {
-    auto* item = m_ui.m_listWidget->currentItem();
-    assert(item != nullptr);
-    return getMsgFromItem(item);
+    auto row = currentRow();
+    assert(0 <= row);
+    return m_model.msgAt(row);
 }
 
 MsgListWidget::MessagesList MsgListWidget::allMsgs() const
 {
-    MessagesList allMsgsList;
-    for (auto idx = 0; idx < m_ui.m_listWidget->count(); ++idx) {
-        auto* item = m_ui.m_listWidget->item(idx);
-        auto msgPtr = getMsgFromItem(item);
-        assert(msgPtr);
-        allMsgsList.push_back(std::move(msgPtr));
-    }
-    return allMsgsList;
+    return m_model.allMsgs();
 }
 
-void MsgListWidget::itemClicked(QListWidgetItem* item)
+void MsgListWidget::itemClicked(const QModelIndex& idx)
 {
-    assert(item != nullptr);
-    if (m_selectedItem == item) {
+    assert(idx.isValid());
+    if (m_selectedIdx == idx) {
         assert(0 < m_lastSelectionTimestamp);
         auto timestamp = QDateTime::currentMSecsSinceEpoch();
         static const decltype(timestamp) MinThreshold = 250;
@@ -356,15 +336,19 @@ void MsgListWidget::itemClicked(QListWidgetItem* item)
         }
     }
 
-    processClick(item);
+    processClick(idx);
 }
 
-void MsgListWidget::currentItemChanged(QListWidgetItem* current, QListWidgetItem* prev)
+void MsgListWidget::currentItemChanged(const QModelIndex& current, const QModelIndex& prev)
 {
     static_cast<void>(prev);
 
-    m_selectedItem = current;
-    if (current != nullptr) {
+    m_selectedIdx = current;
+    if (m_ignoreCurrentChange) {
+        return;
+    }
+
+    if (current.isValid()) {
         m_lastSelectionTimestamp = QDateTime::currentMSecsSinceEpoch();
         processClick(current);
         return;
@@ -374,31 +358,49 @@ void MsgListWidget::currentItemChanged(QListWidgetItem* current, QListWidgetItem
     return;
 }
 
-void MsgListWidget::itemDoubleClicked(QListWidgetItem* item)
+void MsgListWidget::itemDoubleClicked(const QModelIndex& idx)
 {
+    assert(idx.isValid());
     msgDoubleClickedImpl(
-        getMsgFromItem(item),
-        m_ui.m_listWidget->row(item));
+        m_model.msgAt(idx.row()),
+        idx.row());
 }
 
-MessagePtr MsgListWidget::getMsgFromItem(QListWidgetItem* item) const
+void MsgListWidget::refreshView()
 {
-    auto var = item->data(Qt::UserRole);
-    assert(var.canConvert<MessagePtr>());
-    return var.value<MessagePtr>();
+    m_refreshScheduled = false;
+    if (currentRow() < 0) {
+        m_ui.m_listView->scrollToBottom();
+    }
+
+    updateTitle();
 }
 
-QString MsgListWidget::getMsgNameText(MessagePtr msg)
+QString MsgListWidget::getMsgNameText(const Message& msg) const
 {
-    assert(msg);
-    auto itemStr = msgPrefixImpl(*msg);
+    auto itemStr = msgPrefixImpl(msg);
     if (!itemStr.isEmpty()) {
         itemStr.append(": ");
     }
-    itemStr.append(msg->name());
+    itemStr.append(msg.name());
     return itemStr;
 }
 
+Qt::GlobalColor MsgListWidget::getMsgColour(const Message& msg) const
+{
+    bool valid = msg.isValid();
+    if (msg.idAsString().isEmpty()) {
+        return defaultItemColour(false);
+    }
+
+    auto type = property::message::Type().getFrom(msg);
+    if (type != MsgType::Invalid) {
+        return getItemColourImpl(type, valid);
+    }
+
+    return defaultItemColour(valid);
+}
+
 Qt::GlobalColor MsgListWidget::defaultItemColour(bool valid) const
 {
     if (valid) {
@@ -407,13 +409,35 @@ Qt::GlobalColor MsgListWidget::defaultItemColour(bool valid) const
     return Qt::red;
 }
 
+int MsgListWidget::currentRow() const
+{
+    auto idx = m_ui.m_listView->currentIndex();
+    if (!idx.isValid()) {
+        return -1;
+    }
+    return idx.row();
+}
+
+void MsgListWidget::setCurrentRow(int row)
+{
+    m_ignoreCurrentChange = true;
+    if (row < 0) {
+        m_ui.m_listView->setCurrentIndex(QModelIndex());
+    }
+    else {
+        m_ui.m_listView->setCurrentIndex(m_model.index(row));
+    }
+    m_ignoreCurrentChange = false;
+}
+
 void MsgListWidget::moveItem(int fromRow, int toRow)
 {
-    assert(fromRow < m_ui.m_listWidget->count());
-    auto* item = m_ui.m_listWidget->takeItem(fromRow);
-    assert(toRow <= m_ui.m_listWidget->count());
-    m_ui.m_listWidget->insertItem(toRow, item);
-    m_ui.m_listWidget->setCurrentRow(toRow);
+    assert(fromRow < m_model.count());
+    assert(toRow < m_model.count());
+    m_ignoreCurrentChange = true;
+    m_model.moveMsg(fromRow, toRow);
+    m_ignoreCurrentChange = false;
+    setCurrentRow(toRow);
     msgMovedImpl(toRow);
 }
 
@@ -421,18 +445,27 @@ void MsgListWidget::updateTitle()
 {
     auto title =
         m_title +
-        QString(" [%1]").arg(m_ui.m_listWidget->count(), 1, 10, QChar('0'));
+        QString(" [%1]").arg(m_model.count(), 1, 10, QChar('0'));
     m_ui.m_groupBox->setTitle(title);
 }
 
-void MsgListWidget::processClick(QListWidgetItem* item)
+void MsgListWidget::scheduleRefresh()
+{
+    if (m_refreshScheduled) {
+        return;
+    }
+
+    m_refreshScheduled = true;
+    QTimer::singleShot(0, this, SLOT(refreshView()));
+}
+
+void MsgListWidget::processClick(const QModelIndex& idx)
 {
+    assert(idx.isValid());
     msgClickedImpl(
-        getMsgFromItem(item),
-        m_ui.m_listWidget->row(item));
+        m_model.msgAt(idx.row()),
+        idx.row());
 }
 
 
 }  // namespace comms_champion
-
-
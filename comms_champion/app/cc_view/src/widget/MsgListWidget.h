@@ -24,6 +24,8 @@ CC_DISABLE_WARNINGS()
 #include <QtWidgets/QWidget>
 #include <QtCore/QString>
 #include <QtCore/qnamespace.h>
+#include <QtCore/QModelIndex>
+#include <QtCore/QPersistentModelIndex>
 
 #include "ui_MsgListWidget.h"
 CC_ENABLE_WARNINGS()
@@ -32,6 +34,7 @@ CC_ENABLE_WARNINGS()
 #include "comms_champion/Protocol.h"
 
 #include "GuiAppMgr.h"
+#include "MsgListModel.h"
 
 namespace comms_champion
 {
@@ -53,6 +56,7 @@ public:
 
 protected slots:
     void addMessage(MessagePtr msg);
+    void addMessages(const MessagesList& msgs);
     void updateCurrentMessage(MessagePtr msg);
     void deleteCurrentMessage();
     void selectOnAdd(bool enabled);
@@ -86,23 +90,30 @@ protected:
     MessagesList allMsgs() const;
 
 private slots:
-    void itemClicked(QListWidgetItem* item);
-    void currentItemChanged(QListWidgetItem* current, QListWidgetItem* prev);
-    void itemDoubleClicked(QListWidgetItem* item);
+    void itemClicked(const QModelIndex& idx);
+    void currentItemChanged(const QModelIndex& current, const QModelIndex& prev);
+    void itemDoubleClicked(const QModelIndex& idx);
+    void refreshView();
 
 private:
-    MessagePtr getMsgFromItem(QListWidgetItem* item) const;
-    QString getMsgNameText(MessagePtr msg);
+    QString getMsgNameText(const Message& msg) const;
+    Qt::GlobalColor getMsgColour(const Message& msg) const;
     Qt::GlobalColor defaultItemColour(bool valid) const;
+    int currentRow() const;
+    void setCurrentRow(int row);
     void moveItem(int fromRow, int toRow);
     void updateTitle();
-    void processClick(QListWidgetItem* item);
+    void scheduleRefresh();
+    void processClick(const QModelIndex& idx);
 
     Ui::MsgListWidget m_ui;
+    MsgListModel m_model;
     bool m_selectOnAdd = false;
+    bool m_ignoreCurrentChange = false;
+    bool m_refreshScheduled = false;
     QString m_title;
     qint64 m_lastSelectionTimestamp = 0;
-    QListWidgetItem* m_selectedItem = nullptr;
+    QPersistentModelIndex m_selectedIdx;
 };
 
 }  // namespace comms_champion
@@ -24,6 +24,7 @@
 CC_DISABLE_WARNINGS()
 #include <QtCore/QObject>
 #include <QtWidgets/QAction>
+#include <QtWidgets/QLineEdit>
 #include <QtGui/QIcon>
 CC_ENABLE_WARNINGS()
 
@@ -37,6 +38,12 @@ namespace
 
 const QString StartTooltip("Start Reception");
 const QString StopTooltip("Stop Reception");
+const QString FilterTooltip(
+    "Display only messages with specified ID.\n"
+    "FIELD is either index or name of the message field.");
+
+// Filter is applied when the typing pauses for this period
+const int FilterDelay = 300;
 
 QAction* createStartButton(QToolBar& bar)
 {
@@ -116,7 +123,15 @@ QAction* createShowSent(QToolBar& bar)
     return action;
 }
 
-
+QLineEdit* createFilterEdit()
+{
+    auto* edit = new QLineEdit();
+    edit->setPlaceholderText("Filter: ID [FIELD=VALUE]");
+    edit->setToolTip(FilterTooltip);
+    edit->setClearButtonEnabled(true);
+    edit->setMaximumWidth(250);
+    return edit;
+}
 
 }  // namespace
 
@@ -130,6 +145,7 @@ RecvAreaToolBar::RecvAreaToolBar(QWidget* parentObj)
     m_showGarbageButton(createShowGarbage(*this)),
     m_showRecvButton(createShowReceived(*this)),
     m_showSentButton(createShowSent(*this)),
+    m_filterEdit(createFilterEdit()),
     m_state(GuiAppMgr::instance()->recvState()),
     m_sendState(GuiAppMgr::instance()->sendState()),
     m_activeState(GuiAppMgr::instance()->getActivityState())
@@ -138,6 +154,21 @@ RecvAreaToolBar::RecvAreaToolBar(QWidget* parentObj)
     auto empty = new QWidget();
     empty->setSizePolicy(QSizePolicy::Expanding, QSizePolicy::Preferred);
     insertWidget(m_showGarbageButton, empty);
+    insertWidget(m_showGarbageButton, m_filterEdit);
+
+    m_filterTimer.setSingleShot(true);
+    m_filterTimer.setInterval(FilterDelay);
+    connect(
+        &m_filterTimer, SIGNAL(timeout()),
+        this, SLOT(applyFilter()));
+
+    connect(
+        m_filterEdit, SIGNAL(textChanged(const QString&)),
+        this, SLOT(filterTextChanged()));
+
+    connect(
+        m_filterEdit, SIGNAL(editingFinished()),
+        this, SLOT(applyFilter()));
 
     connect(
         m_startStopButton, SIGNAL(triggered()),
@@ -164,6 +195,10 @@ RecvAreaToolBar::RecvAreaToolBar(QWidget* parentObj)
         guiAppMgr, SIGNAL(sigActivityStateChanged(int)),
         this, SLOT(activeStateChanged(int)));
 
+    connect(
+        guiAppMgr, SIGNAL(sigRecvFilterErrorReport(const QString&)),
+        this, SLOT(filterErrorReport(const QString&)));
+
     refresh();
 }
 
@@ -225,6 +260,30 @@ void RecvAreaToolBar::activeStateChanged(int state)
     refresh();
 }
 
+void RecvAreaToolBar::filterTextChanged()
+{
+    m_filterTimer.start();
+}
+
+void RecvAreaToolBar::applyFilter()
+{
+    m_filterTimer.stop();
+    GuiAppMgr::instance()->recvFilterChanged(m_filterEdit->text());
+}
+
+void RecvAreaToolBar::filterErrorReport(const QString& error)
+{
+    static const QString InvalidStylesheet("QLineEdit { color: red }");
+    if (error.isEmpty()) {
+        m_filterEdit->setStyleSheet(QString());
+        m_filterEdit->setToolTip(FilterTooltip);
+        return;
+    }
+
+    m_filterEdit->setStyleSheet(InvalidStylesheet);
+    m_filterEdit->setToolTip(error);
+}
+
 void RecvAreaToolBar::refresh()
 {
     refreshStartStopButton();
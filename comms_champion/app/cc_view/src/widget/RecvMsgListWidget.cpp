@@ -43,8 +43,8 @@ RecvMsgListWidget::RecvMsgListWidget(QWidget* parentObj)
     selectOnAdd(guiMgr->recvMsgListSelectOnAddEnabled());
 
     connect(
-        guiMgr, SIGNAL(sigAddRecvMsg(MessagePtr)),
-        this, SLOT(addMessage(MessagePtr)));
+        guiMgr, SIGNAL(sigAddRecvMsgs(const MessagesList&)),
+        this, SLOT(addMessages(const MessagesList&)));
     connect(
         guiMgr, SIGNAL(sigRecvMsgListSelectOnAddEnabled(bool)),
         this, SLOT(selectOnAdd(bool)));
@@ -76,6 +76,8 @@ void ArrayListElementWidget::updateUi()
     m_ui.m_sepLine->setVisible(deleteButtonVisible);
 }
 
+const unsigned ArrayListFieldWidget::ElementsPerPage;
+
 ArrayListFieldWidget::ArrayListFieldWidget(
     WrapperPtr wrapper,
     CreateMissingDataFieldsFunc&& updateFunc,
@@ -98,23 +100,42 @@ ArrayListFieldWidget::ArrayListFieldWidget(
     connect(
         m_ui.m_addFieldPushButton, SIGNAL(clicked()),
         this, SLOT(addNewField()));
+
+    connect(
+        m_ui.m_pageSpinBox, SIGNAL(valueChanged(int)),
+        this, SLOT(pageChanged(int)));
+
+    connect(
+        m_ui.m_prevPagePushButton, SIGNAL(clicked()),
+        this, SLOT(prevPage()));
+
+    connect(
+        m_ui.m_nextPagePushButton, SIGNAL(clicked()),
+        this, SLOT(nextPage()));
 }
 
 ArrayListFieldWidget::~ArrayListFieldWidget() = default;
 
 void ArrayListFieldWidget::refreshImpl()
 {
-    while (!m_elements.empty()) {
-        assert(m_elements.back() != nullptr);
-        delete m_elements.back();
-        m_elements.pop_back();
-    }
+    clearElements();
 
     m_wrapper->refreshMembers();
 
     refreshInternal();
     addMissingFields();
-    assert(m_elements.size() == m_wrapper->size());
+    assert(m_elements.size() == pageElemsCount());
+}
+
+bool ArrayListFieldWidget::rebindImpl(field_wrapper::FieldWrapper& wrapper)
+{
+    if (!m_wrapper->rebind(wrapper)) {
+        return false;
+    }
+
+    // Elements' widgets are recreated on refresh
+    m_page = 0U;
+    return true;
 }
 
 void ArrayListFieldWidget::editEnabledUpdatedImpl()
@@ -141,7 +162,7 @@ void ArrayListFieldWidget::updatePropertiesImpl(const QVariantMap& props)
         return;
     }
 
-    unsigned idx = 0;
+    auto idx = static_cast<unsigned>(pageFirstIdx() % m_elemProperties.size());
     for (auto* elem : m_elements) {
         elem->updateProperties(m_elemProperties[idx]);
         idx = ((idx + 1) % m_elemProperties.size());
@@ -158,8 +179,9 @@ void ArrayListFieldWidget::dataFieldUpdated()
 void ArrayListFieldWidget::addNewField()
 {
     m_wrapper->addField();
+    m_page = pagesCount() - 1U;
     refreshImpl();
-    assert(m_elements.size() == m_wrapper->size());
+    assert(m_elements.size() == pageElemsCount());
     emitFieldUpdated();
 }
 
@@ -172,18 +194,50 @@ void ArrayListFieldWidget::removeField()
         return;
     }
 
-    auto idx = static_cast<int>(std::distance(m_elements.begin(), iter));
+    auto idx =
+        static_cast<int>(pageFirstIdx()) +
+        static_cast<int>(std::distance(m_elements.begin(), iter));
 
     m_wrapper->removeField(idx);
 
     refreshImpl();
 
-    assert(m_elements.size() == m_wrapper->size());
+    assert(m_elements.size() == pageElemsCount());
     assert(m_elements.size() == (unsigned)m_ui.m_membersLayout->count());
 
     emitFieldUpdated();
 }
 
+void ArrayListFieldWidget::pageChanged(int value)
+{
+    auto page = static_cast<unsigned>(std::max(value - 1, 0));
+    if ((page == m_page) || (pagesCount() <= page)) {
+        return;
+    }
+
+    m_page = page;
+    clearElements();
+    addMissingFields();
+}
+
+void ArrayListFieldWidget::prevPage()
+{
+    if (m_page == 0U) {
+        return;
+    }
+
+    m_ui.m_pageSpinBox->setValue(static_cast<int>(m_page));
+}
+
+void ArrayListFieldWidget::nextPage()
+{
+    if (pagesCount() <= (m_page + 1U)) {
+        return;
+    }
+
+    m_ui.m_pageSpinBox->setValue(static_cast<int>(m_page + 2U));
+}
+
 void ArrayListFieldWidget::addDataField(FieldWidget* dataFieldWidget)
 {
     auto* wrapperWidget = new ArrayListElementWidget(dataFieldWidget);
@@ -191,7 +245,7 @@ void ArrayListFieldWidget::addDataField(FieldWidget* dataFieldWidget)
     wrapperWidget->setDeletable(!m_wrapper->hasFixedSize());
 
     if (!m_elemProperties.empty()) {
-        auto elemPropsIdx = m_elements.size() % m_elemProperties.size();
+        auto elemPropsIdx = (pageFirstIdx() + m_elements.size()) % m_elemProperties.size();
         assert(elemPropsIdx < m_elemProperties.size());
         auto& elemProps = m_elemProperties[elemPropsIdx];
         wrapperWidget->updateProperties(elemProps);
@@ -237,13 +291,16 @@ void ArrayListFieldWidget::addMissingFields()
     }
 
     assert(m_elements.empty());
-    auto fieldWidgets = m_createMissingDataFieldsCallback(*m_wrapper);
+    m_page = std::min(m_page, pagesCount() - 1U);
+    auto fieldWidgets =
+        m_createMissingDataFieldsCallback(*m_wrapper, pageFirstIdx(), pageElemsCount());
     for (auto& fieldWidgetPtr : fieldWidgets) {
         addDataField(fieldWidgetPtr.release());
     }
 
-    assert(m_elements.size() == m_wrapper->size());
+    assert(m_elements.size() == pageElemsCount());
     assert(m_elements.size() == (unsigned)m_ui.m_membersLayout->count());
+    updatePageUi();
 }
 
 void ArrayListFieldWidget::updatePrefixField()
@@ -263,6 +320,62 @@ void ArrayListFieldWidget::updatePrefixField()
     m_ui.m_prefixFieldWidget->show();
 }
 
+void ArrayListFieldWidget::clearElements()
+{
+    while (!m_elements.empty()) {
+        assert(m_elements.back() != nullptr);
+        delete m_elements.back();
+        m_elements.pop_back();
+    }
+}
+
+void ArrayListFieldWidget::updatePageUi()
+{
+    m_ui.m_countLabel->setText(tr("Elements: %1").arg(m_wrapper->size()));
+
+    auto pages = pagesCount();
+    bool navVisible = (1U < pages);
+    m_ui.m_pageNavWidget->setVisible(navVisible);
+    if (!navVisible) {
+        return;
+    }
+
+    m_ui.m_pagesCountLabel->setText(tr("of %1").arg(pages));
+    m_ui.m_prevPagePushButton->setEnabled(0U < m_page);
+    m_ui.m_nextPagePushButton->setEnabled((m_page + 1U) < pages);
+
+    bool signalsWereBlocked = m_ui.m_pageSpinBox->blockSignals(true);
+    m_ui.m_pageSpinBox->setMaximum(static_cast<int>(pages));
+    m_ui.m_pageSpinBox->setValue(static_cast<int>(m_page + 1U));
+    m_ui.m_pageSpinBox->blockSignals(signalsWereBlocked);
+}
+
+unsigned ArrayListFieldWidget::pagesCount() const
+{
+    auto size = m_wrapper->size();
+    if (size == 0U) {
+        return 1U;
+    }
+
+    return ((size - 1U) / ElementsPerPage) + 1U;
+}
+
+unsigned ArrayListFieldWidget::pageFirstIdx() const
+{
+    return m_page * ElementsPerPage;
+}
+
+unsigned ArrayListFieldWidget::pageElemsCount() const
+{
+    auto size = m_wrapper->size();
+    auto firstIdx = pageFirstIdx();
+    if (size <= firstIdx) {
+        return 0U;
+    }
+
+    return std::min(size - firstIdx, ElementsPerPage);
+}
+
 }  // namespace comms_champion
 
 
@@ -71,7 +71,7 @@ class ArrayListFieldWidget : public FieldWidget
 public:
     using Wrapper = field_wrapper::ArrayListWrapper;
     using WrapperPtr = Wrapper::Ptr;
-    typedef std::function<std::vector<FieldWidgetPtr> (Wrapper&)> CreateMissingDataFieldsFunc;
+    typedef std::function<std::vector<FieldWidgetPtr> (Wrapper&, unsigned, unsigned)> CreateMissingDataFieldsFunc;
 
     explicit ArrayListFieldWidget(
         WrapperPtr wrapper,
@@ -89,6 +89,7 @@ public:
 
 protected:
     virtual void refreshImpl() override;
+    virtual bool rebindImpl(field_wrapper::FieldWrapper& wrapper) override;
     virtual void editEnabledUpdatedImpl() override;
     virtual void updatePropertiesImpl(const QVariantMap& props) override;
 
@@ -96,14 +97,23 @@ private slots:
     void dataFieldUpdated();
     void addNewField();
     void removeField();
+    void pageChanged(int value);
+    void prevPage();
+    void nextPage();
 
 private:
+    static const unsigned ElementsPerPage = 100U;
 
     void addDataField(FieldWidget* dataFieldWidget);
     void refreshInternal();
     void updateUi();
     void addMissingFields();
     void updatePrefixField();
+    void clearElements();
+    void updatePageUi();
+    unsigned pagesCount() const;
+    unsigned pageFirstIdx() const;
+    unsigned pageElemsCount() const;
 
     Ui::ArrayListFieldWidget m_ui;
     WrapperPtr m_wrapper;
@@ -111,6 +121,7 @@ private:
     CreateMissingDataFieldsFunc m_createMissingDataFieldsCallback;
     std::vector<QVariantMap> m_elemProperties;
     bool m_prefixVisible = false;
+    unsigned m_page = 0U;
 };
 
 }  // namespace comms_champion
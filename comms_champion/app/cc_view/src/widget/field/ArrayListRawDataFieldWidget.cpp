@@ -85,6 +85,11 @@ void ArrayListRawDataFieldWidget::refreshImpl()
     setValidityStyleSheet(*m_ui.m_serBackLabel, valid);
 }
 
+bool ArrayListRawDataFieldWidget::rebindImpl(field_wrapper::FieldWrapper& wrapper)
+{
+    return m_wrapper->rebind(wrapper);
+}
+
 void ArrayListRawDataFieldWidget::editEnabledUpdatedImpl()
 {
     bool readonly = !isEditEnabled();
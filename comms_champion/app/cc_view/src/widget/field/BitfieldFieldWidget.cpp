@@ -81,6 +81,25 @@ void BitfieldFieldWidget::refreshImpl()
     refreshMembers();
 }
 
+bool BitfieldFieldWidget::rebindImpl(field_wrapper::FieldWrapper& wrapper)
+{
+    if (!m_wrapper->rebind(wrapper)) {
+        return false;
+    }
+
+    auto& membersWrappers = static_cast<field_wrapper::BitfieldWrapper&>(wrapper).getMembers();
+    if (membersWrappers.size() != m_members.size()) {
+        return false;
+    }
+
+    for (auto idx = 0U; idx < m_members.size(); ++idx) {
+        if (!m_members[idx]->rebind(*membersWrappers[idx])) {
+            return false;
+        }
+    }
+    return true;
+}
+
 void BitfieldFieldWidget::editEnabledUpdatedImpl()
 {
     bool readonly = !isEditEnabled();
@@ -84,6 +84,11 @@ void BitmaskValueFieldWidget::refreshImpl()
     setValidityStyleSheet(*m_ui.m_serBackLabel, valid);
 }
 
+bool BitmaskValueFieldWidget::rebindImpl(field_wrapper::FieldWrapper& wrapper)
+{
+    return m_wrapper->rebind(wrapper);
+}
+
 void BitmaskValueFieldWidget::editEnabledUpdatedImpl()
 {
     bool readonly = !isEditEnabled();
@@ -29,6 +29,7 @@ CC_DISABLE_WARNINGS()
 CC_ENABLE_WARNINGS()
 
 #include "comms_champion/property/field.h"
+#include "comms_champion/field_wrapper/BundleWrapper.h"
 
 namespace comms_champion
 {
@@ -72,6 +73,26 @@ void BundleFieldWidget::refreshImpl()
     }
 }
 
+bool BundleFieldWidget::rebindImpl(field_wrapper::FieldWrapper& wrapper)
+{
+    auto* bundleWrapper = dynamic_cast<field_wrapper::BundleWrapper*>(&wrapper);
+    if (bundleWrapper == nullptr) {
+        return false;
+    }
+
+    auto& membersWrappers = bundleWrapper->getMembers();
+    if (membersWrappers.size() != m_members.size()) {
+        return false;
+    }
+
+    for (auto idx = 0U; idx < m_members.size(); ++idx) {
+        if (!m_members[idx]->rebind(*membersWrappers[idx])) {
+            return false;
+        }
+    }
+    return true;
+}
+
 void BundleFieldWidget::editEnabledUpdatedImpl()
 {
     bool enabled = isEditEnabled();
@@ -105,6 +105,11 @@ void EnumValueFieldWidget::refreshImpl()
     setValidityStyleSheet(*m_ui.m_serBackLabel, valid);
 }
 
+bool EnumValueFieldWidget::rebindImpl(field_wrapper::FieldWrapper& wrapper)
+{
+    return m_wrapper->rebind(wrapper);
+}
+
 void EnumValueFieldWidget::editEnabledUpdatedImpl()
 {
     bool readonly = !isEditEnabled();
@@ -64,6 +64,11 @@ void FieldWidget::refresh()
     refreshImpl();
 }
 
+bool FieldWidget::rebind(field_wrapper::FieldWrapper& wrapper)
+{
+    return rebindImpl(wrapper);
+}
+
 void FieldWidget::setEditEnabled(bool enabled)
 {
     m_editEnabled = enabled;
@@ -47,6 +47,8 @@ public:
     FieldWidget(QWidget* parentObj = nullptr);
     ~FieldWidget() = default;
 
+    bool rebind(field_wrapper::FieldWrapper& wrapper);
+
 public slots:
     void refresh();
     void setEditEnabled(bool enabled);
@@ -108,6 +110,7 @@ protected:
     }
 
     virtual void refreshImpl() = 0;
+    virtual bool rebindImpl(field_wrapper::FieldWrapper& wrapper) = 0;
     virtual void editEnabledUpdatedImpl();
     virtual void updatePropertiesImpl(const QVariantMap& props);
 
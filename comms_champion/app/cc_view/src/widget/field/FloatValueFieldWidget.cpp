@@ -80,6 +80,11 @@ void FloatValueFieldWidget::refreshImpl()
     setValidityStyleSheet(*m_ui.m_serBackLabel, valid);
 }
 
+bool FloatValueFieldWidget::rebindImpl(field_wrapper::FieldWrapper& wrapper)
+{
+    return m_wrapper->rebind(wrapper);
+}
+
 void FloatValueFieldWidget::editEnabledUpdatedImpl()
 {
     bool readonly = !isEditEnabled();
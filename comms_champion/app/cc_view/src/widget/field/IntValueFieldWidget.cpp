@@ -54,6 +54,16 @@ void IntValueFieldWidget::refreshImpl()
     }
 }
 
+bool IntValueFieldWidget::rebindImpl(field_wrapper::FieldWrapper& wrapper)
+{
+    if (m_childWidget) {
+        return m_childWidget->rebind(wrapper);
+    }
+
+    assert(m_wrapper);
+    return m_wrapper->rebind(wrapper);
+}
+
 void IntValueFieldWidget::editEnabledUpdatedImpl()
 {
     if (m_childWidget) {
@@ -76,6 +76,11 @@ void LongIntValueFieldWidget::refreshImpl()
     setValidityStyleSheet(*m_ui.m_serBackLabel, valid);
 }
 
+bool LongIntValueFieldWidget::rebindImpl(field_wrapper::FieldWrapper& wrapper)
+{
+    return m_wrapper->rebind(wrapper);
+}
+
 void LongIntValueFieldWidget::editEnabledUpdatedImpl()
 {
     bool readonly = !isEditEnabled();
@@ -72,6 +72,17 @@ void OptionalFieldWidget::refreshImpl()
     refreshField();
 }
 
+bool OptionalFieldWidget::rebindImpl(field_wrapper::FieldWrapper& wrapper)
+{
+    if (!m_wrapper->rebind(wrapper)) {
+        return false;
+    }
+
+    assert(m_field != nullptr);
+    auto& optWrapper = static_cast<field_wrapper::OptionalWrapper&>(wrapper);
+    return m_field->rebind(optWrapper.getFieldWrapper());
+}
+
 void OptionalFieldWidget::editEnabledUpdatedImpl()
 {
     assert(m_field != nullptr);
@@ -68,6 +68,11 @@ void StringFieldWidget::refreshImpl()
     setValidityStyleSheet(*m_ui.m_serBackLabel, valid);
 }
 
+bool StringFieldWidget::rebindImpl(field_wrapper::FieldWrapper& wrapper)
+{
+    return m_wrapper->rebind(wrapper);
+}
+
 void StringFieldWidget::editEnabledUpdatedImpl()
 {
     bool readonly = !isEditEnabled();
@@ -54,6 +54,11 @@ void UnknownValueFieldWidget::refreshImpl()
     setFieldValid(m_wrapper->valid());
 }
 
+bool UnknownValueFieldWidget::rebindImpl(field_wrapper::FieldWrapper& wrapper)
+{
+    return m_wrapper->rebind(wrapper);
+}
+
 void UnknownValueFieldWidget::editEnabledUpdatedImpl()
 {
     bool readonly = !isEditEnabled();
@@ -72,6 +72,45 @@ void VariantFieldWidget::refreshImpl()
     refreshMember();
 }
 
+bool VariantFieldWidget::rebindImpl(field_wrapper::FieldWrapper& wrapper)
+{
+    if (!m_wrapper->rebind(wrapper)) {
+        return false;
+    }
+
+    auto& memberWrapper = m_wrapper->getCurrent();
+    bool memberRebound =
+        (m_member != nullptr) &&
+        (memberWrapper) &&
+        (m_ui.m_idxSpinBox->value() == m_wrapper->getCurrentIndex()) &&
+        (m_member->rebind(*memberWrapper));
+
+    if (memberRebound) {
+        return true;
+    }
+
+    delete m_member;
+    m_member = nullptr;
+
+    bool signalsWereBlocked = m_ui.m_idxSpinBox->blockSignals(true);
+    m_ui.m_idxSpinBox->setValue(m_wrapper->getCurrentIndex());
+    m_ui.m_idxSpinBox->blockSignals(signalsWereBlocked);
+
+    if (memberWrapper) {
+        assert(m_createFunc);
+        auto fieldWidget = m_createFunc(*memberWrapper);
+        m_member = fieldWidget.release();
+        m_ui.m_membersLayout->addWidget(m_member);
+        updateMemberProps();
+        m_member->setEditEnabled(isEditEnabled());
+
+        connect(
+            m_member, SIGNAL(sigFieldUpdated()),
+            this, SLOT(memberFieldUpdated()));
+    }
+    return true;
+}
+
 void VariantFieldWidget::editEnabledUpdatedImpl()
 {
     bool readOnly = !isEditEnabled();
@@ -19,6 +19,7 @@
 #pragma once
 
 #include <chrono>
+#include <cstdint>
 #include <vector>
 #include <string>
 #include <memory>
@@ -51,10 +52,15 @@ struct DataInfo
     /// @brief Type of extra properties storage
     using PropertiesMap = QVariantMap;
 
+    /// @brief Type of the key identifying stream (connection) of the data
+    using StreamKey = std::uint64_t;
+
     Timestamp m_timestamp; ///< Timestam when data has been received / sent
     DataSeq m_data; ///< Actual raw data
     PropertiesMap m_extraProperties; ///< Extra properties that can be used by
                                      /// other componets
+    StreamKey m_streamKey = 0U; ///< Stream (connection) the data belongs to,
+                                /// @b 0 is the default stream
 };
 
 /// @brief Pointer to @ref DataInfo
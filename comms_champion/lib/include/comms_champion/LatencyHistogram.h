@@ -0,0 +1,84 @@
+//
+// Copyright 2017 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+#include "Api.h"
+
+namespace comms_champion
+{
+
+/// @brief Histogram of latency values with bounded relative error.
+/// @details Values (usually in microseconds) are recorded into logarithmic
+///     buckets, each power of two is split into 64 linear sub-buckets,
+///     which keeps the relative error of the reported percentiles
+///     below 1.6%. Values up to 2^40 are tracked, the bigger ones are
+///     clamped.
+/// @headerfile comms_champion/LatencyHistogram.h
+class CC_API LatencyHistogram
+{
+public:
+    /// @brief Type of recorded value
+    typedef std::uint64_t ValueType;
+
+    /// @brief Constructor
+    LatencyHistogram();
+
+    /// @brief Record single value.
+    void record(ValueType value);
+
+    /// @brief Add all the values recorded by other histogram.
+    void merge(const LatencyHistogram& other);
+
+    /// @brief Remove all the recorded values.
+    void reset();
+
+    /// @brief Number of recorded values.
+    std::uint64_t count() const;
+
+    /// @brief Minimal recorded value, @b 0 when empty.
+    ValueType min() const;
+
+    /// @brief Maximal recorded value, @b 0 when empty.
+    ValueType max() const;
+
+    /// @brief Mean of the recorded values, @b 0 when empty.
+    double mean() const;
+
+    /// @brief Value below or equal to which provided percentage of the
+    ///     recorded values fall.
+    /// @param[in] percentile Value in range [0, 100].
+    ValueType valueAtPercentile(double percentile) const;
+
+private:
+    static std::size_t bucketIdx(ValueType value);
+    static ValueType bucketValue(std::size_t idx);
+
+    std::vector<std::uint64_t> m_buckets;
+    std::uint64_t m_count = 0U;
+    ValueType m_min = 0U;
+    ValueType m_max = 0U;
+    double m_sum = 0.0;
+};
+
+}  // namespace comms_champion
+
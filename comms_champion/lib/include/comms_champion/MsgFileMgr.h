@@ -67,6 +67,8 @@ public:
     typedef std::shared_ptr<QFile> FileSaveHandler;
     static FileSaveHandler startRecvSave(const QString& filename);
     static void addToRecvSave(FileSaveHandler handler, const Message& msg, bool flush = false);
+    static void addToRecvSave(FileSaveHandler handler, const QVariantMap& msgInfo, bool flush = false);
+    static QVariantMap recvMsgInfo(const Message& msg);
     static void flushRecvFile(FileSaveHandler handler);
 
 private:
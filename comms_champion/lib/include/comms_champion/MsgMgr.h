@@ -20,6 +20,8 @@
 
 #include <memory>
 #include <vector>
+#include <array>
+#include <functional>
 
 #include "Api.h"
 #include "Message.h"
@@ -27,6 +29,7 @@
 #include "Message.h"
 #include "Socket.h"
 #include "Filter.h"
+#include "LatencyHistogram.h"
 
 namespace comms_champion
 {
@@ -39,6 +42,37 @@ public:
     typedef Protocol::MessagesList MessagesList;
 
     typedef Message::Type MsgType;
+    typedef std::function<ProtocolPtr ()> ProtocolCreateFunc;
+    typedef std::function<void (const Message& msg, DataInfo& data)> SendFramePatchFunc;
+
+    struct DecodeStats
+    {
+        unsigned long long m_droppedData = 0U;
+        std::size_t m_queued = 0U;
+        bool m_threaded = false;
+    };
+
+    /// @brief Points of the receive pipeline where latency is measured.
+    /// @details All the values except LatencyStage_Callback are measured
+    ///     from the time the data has been received by the socket.
+    enum LatencyStage
+    {
+        LatencyStage_Filtered, ///< Data has been processed by all the filters
+        LatencyStage_Decoded, ///< Message has been decoded
+        LatencyStage_Reported, ///< Message added callback has returned
+        LatencyStage_Callback, ///< Duration of the message added callback itself
+        LatencyStage_NumOfValues ///< Limit to available values
+    };
+
+    /// @brief Latency histograms (in microseconds) for every stage
+    typedef std::array<LatencyHistogram, LatencyStage_NumOfValues> LatencyStats;
+
+    struct MsgsQuery
+    {
+        QString m_id;
+        int m_fieldIdx = -1;
+        QString m_fieldValue;
+    };
 
     MsgMgr();
     ~MsgMgr();
@@ -50,17 +84,29 @@ public:
     SocketPtr getSocket() const;
     ProtocolPtr getProtocol() const;
     void setRecvEnabled(bool enabled);
+    void setStoreMsgsEnabled(bool enabled);
 
     void deleteMsg(MessagePtr msg);
     void deleteAllMsgs();
 
     void sendMsgs(MessagesList&& msgs);
+    void setSendFramePatchFunc(SendFramePatchFunc&& func);
+    void clearFrameCache();
+    static unsigned long long allocFrameCacheKey();
 
     const AllMessages& getAllMsgs() const;
     void addMsgs(const MessagesList& msgs, bool reportAdded = true);
+    AllMessages findMsgs(const MsgsQuery& query);
+    static bool msgMatches(Message& msg, const MsgsQuery& query);
 
     void setSocket(SocketPtr socket);
     void setProtocol(ProtocolPtr protocol);
+    void setDecodeProtocolCreateFunc(ProtocolCreateFunc&& func);
+    DecodeStats getDecodeStats() const;
+    void setLatencyStatsEnabled(bool enabled);
+    LatencyStats getLatencyStats() const;
+    void resetLatencyStats();
+    static const char* latencyStageName(LatencyStage stage);
     void addFilter(FilterPtr filter);
 
     typedef std::function<void (MessagePtr msg)> MsgAddedCallbackFunc;
@@ -0,0 +1,118 @@
+//
+// Copyright 2017 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+#include "Api.h"
+#include "Protocol.h"
+
+namespace comms_champion
+{
+
+/// @brief Parser of large raw data captures utilising multiple threads.
+/// @details Splits the raw data into chunks, finds frame boundaries at
+///     the chunks' edges using Protocol::findFrameStart() and decodes
+///     every chunk using separate protocol instance on a pool of worker
+///     threads. The decoded messages are moved to the thread calling parse()
+///     and dispatched chunk by chunk in order of their appearance in the
+///     data. Only limited number of chunks is decoded ahead of the
+///     dispatch to keep the memory consumption bounded. When the protocol
+///     doesn't support frame boundary search, the data is decoded as a single
+///     chunk.
+/// @headerfile comms_champion/ParallelParser.h
+class CC_API ParallelParser
+{
+public:
+    /// @brief List of decoded messages
+    typedef Protocol::MessagesList MessagesList;
+
+    /// @brief Type of protocol creation function.
+    /// @details Always invoked by the thread calling parse().
+    typedef std::function<ProtocolPtr ()> ProtocolCreateFunc;
+
+    /// @brief Type of decoded messages dispatch function.
+    /// @details Always invoked by the thread calling parse() with messages of
+    ///     a single chunk.
+    typedef std::function<void (MessagesList&& msgs)> DispatchFunc;
+
+    /// @brief Statistics of the last parse() operation.
+    struct Stats
+    {
+        std::size_t m_bytes = 0U; ///< Number of processed bytes
+        std::size_t m_chunks = 0U; ///< Number of decoded chunks
+        std::size_t m_messages = 0U; ///< Number of produced messages
+        unsigned m_threads = 0U; ///< Number of used worker threads
+        unsigned long long m_elapsedMs = 0U; ///< Total time in milliseconds
+
+        /// @brief Throughput in megabytes per second.
+        double throughput() const;
+    };
+
+    ParallelParser();
+    ~ParallelParser();
+
+    /// @brief Set protocol creation function
+    void setProtocolCreateFunc(ProtocolCreateFunc&& func);
+
+    /// @brief Set dispatch function of the decoded messages.
+    /// @details When not set, the decoded messages are discarded.
+    void setDispatchFunc(DispatchFunc&& func);
+
+    /// @brief Set number of worker threads.
+    /// @details @b 0 (default) means number of available cores.
+    void setThreadsCount(unsigned count);
+
+    /// @brief Set nominal size of the chunk.
+    void setChunkSize(std::size_t size);
+
+    /// @brief Set maximal distance from the nominal chunk edge the frame
+    ///     start is searched at.
+    /// @details When the frame start isn't found, the chunk is merged with
+    ///     the previous one.
+    void setFrameSearchLimit(std::size_t limit);
+
+    /// @brief Parse raw data.
+    /// @details Blocks until all the chunks are decoded and dispatched.
+    void parse(const std::uint8_t* data, std::size_t size);
+
+    /// @brief Retrieve statistics of the last parse() operation.
+    const Stats& lastStats() const;
+
+private:
+    typedef std::vector<std::size_t> BoundariesList;
+
+    unsigned threadsCount() const;
+    BoundariesList findBoundaries(
+        std::vector<ProtocolPtr>& protocols,
+        const std::uint8_t* data,
+        std::size_t size,
+        std::size_t chunksCount);
+
+    ProtocolCreateFunc m_protocolCreateFunc;
+    DispatchFunc m_dispatchFunc;
+    unsigned m_threadsCount = 0U;
+    std::size_t m_chunkSize = 4U * 1024U * 1024U;
+    std::size_t m_frameSearchLimit = 64U * 1024U;
+    Stats m_lastStats;
+};
+
+}  // namespace comms_champion
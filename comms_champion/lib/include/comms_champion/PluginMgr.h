@@ -88,10 +88,20 @@ public:
     typedef std::list<PluginInfoPtr> ListOfPluginInfos;
     typedef Plugin::WidgetPtr WidgetPtr;
 
+    struct Stats
+    {
+        unsigned m_available = 0U;
+        unsigned m_cached = 0U;
+        unsigned m_loaded = 0U;
+        unsigned long long m_scanMs = 0U;
+        unsigned long long m_loadMs = 0U;
+    };
+
     PluginMgr();
     ~PluginMgr();
 
     void setPluginsDir(const QString& pluginDir);
+    void setPluginsIndexFile(const QString& filename);
     const ListOfPluginInfos& getAvailablePlugins();
     const ListOfPluginInfos& getAppliedPlugins() const;
     void setAppliedPlugins(const ListOfPluginInfos& plugins);
@@ -107,6 +117,7 @@ public:
     static QVariantMap getConfigForPlugins(const ListOfPluginInfos& infos);
     const QString& getLastFile() const;
     static const QString& getFilesFilter();
+    const Stats& getStats() const;
 
 private:
     std::unique_ptr<PluginMgrImpl> m_impl;
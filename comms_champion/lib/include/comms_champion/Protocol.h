@@ -22,6 +22,7 @@
 #include <cstdint>
 #include <cstddef>
 #include <list>
+#include <limits>
 
 #include "comms/CompileControl.h"
 
@@ -70,12 +71,33 @@ public:
     const QString& name() const;
 
     /// @brief Read the received data input.
-    /// @details Invokes virtual readImpl().
+    /// @details Invokes virtual readImpl(). The data of different streams
+    ///     (see DataInfo::m_streamKey) is expected to be reassembled
+    ///     independently.
     /// @param[in] dataInfo Received data information
     /// @param[in] final Final input indication, if @b true no more data is expected
     /// @return List of created messages
     MessagesList read(const DataInfo& dataInfo, bool final = false);
 
+    /// @brief Check whether the protocol is able to locate frames in the
+    ///     middle of raw data.
+    /// @details Invokes virtual canFindFrameStartImpl(). When @b false is
+    ///     returned, findFrameStart() mustn't be used to split the data.
+    bool canFindFrameStart() const;
+
+    /// @brief Find beginning of the first valid frame in raw data.
+    /// @details Invokes virtual findFrameStartImpl(). Used to split large
+    ///     raw captures into independently decodable chunks.
+    /// @param[in] data Pointer to the raw data
+    /// @param[in] size Number of bytes in the raw data
+    /// @param[in] maxOffset Frame start is not searched at this and further
+    ///     offsets, the data beyond it is used only to read the frames.
+    /// @return Offset of the first frame, equals to @b size if not found
+    std::size_t findFrameStart(
+        const std::uint8_t* data,
+        std::size_t size,
+        std::size_t maxOffset = std::numeric_limits<std::size_t>::max());
+
     /// @brief Serialse message.
     /// @details Invokes writeImpl().
     /// @param[in] msg Reference to message object, passed by non-const reference
@@ -117,6 +139,19 @@ protected:
     /// @details Invoked by read().
     virtual MessagesList readImpl(const DataInfo& dataInfo, bool final) = 0;
 
+    /// @brief Polymorphic inquiry whether frame boundary search is supported.
+    /// @details Invoked by canFindFrameStart(). The default implementation
+    ///     returns @b false.
+    virtual bool canFindFrameStartImpl() const;
+
+    /// @brief Polymorphic frame boundary search.
+    /// @details Invoked by findFrameStart(). The default implementation
+    ///     is not aware of the framing and reports no frame found.
+    virtual std::size_t findFrameStartImpl(
+        const std::uint8_t* data,
+        std::size_t size,
+        std::size_t maxOffset);
+
     /// @brief Polymorphic write functionality.
     /// @details invoked by write().
     virtual DataInfoPtr writeImpl(Message& msg) = 0;
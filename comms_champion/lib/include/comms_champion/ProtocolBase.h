@@ -21,6 +21,8 @@
 #include <algorithm>
 #include <iterator>
 #include <cassert>
+#include <chrono>
+#include <vector>
 
 
 #include "comms/CompileControl.h"
@@ -109,33 +111,37 @@ protected:
         const std::uint8_t* iter = &dataInfo.m_data[0];
         auto size = dataInfo.m_data.size();
 
+        auto& stream = streamContext(dataInfo.m_streamKey);
+        auto& data = stream.m_data;
+        auto& garbage = stream.m_garbage;
+
         MessagesList allMsgs;
-        m_data.reserve(m_data.size() + size);
-        std::copy_n(iter, size, std::back_inserter(m_data));
+        data.reserve(data.size() + size);
+        std::copy_n(iter, size, std::back_inserter(data));
 
         using ReadIterator = typename ProtocolMessage::ReadIterator;
-        ReadIterator readIterBeg = &m_data[0];
+        ReadIterator readIterBeg = &data[0];
 
         auto remainingSizeCalc =
-            [this](ReadIterator readIter) -> std::size_t
+            [&data](ReadIterator readIter) -> std::size_t
             {
-                ReadIterator const dataBegin = &m_data[0];
+                ReadIterator const dataBegin = &data[0];
                 auto consumed =
                     static_cast<std::size_t>(
                         std::distance(dataBegin, readIter));
-                assert(consumed <= m_data.size());
-                return m_data.size() - consumed;
+                assert(consumed <= data.size());
+                return data.size() - consumed;
             };
 
         auto eraseGuard =
             comms::util::makeScopeGuard(
-                [this, &readIterBeg]()
+                [&data, &readIterBeg]()
                 {
-                    ReadIterator dataBegin = &m_data[0];
+                    ReadIterator dataBegin = &data[0];
                     auto dist =
                         static_cast<std::size_t>(
                             std::distance(dataBegin, readIterBeg));
-                    m_data.erase(m_data.begin(), m_data.begin() + dist);
+                    data.erase(data.begin(), data.begin() + dist);
                 });
 
         auto setExtraInfoFunc =
@@ -158,20 +164,20 @@ protected:
             };
 
         auto checkGarbageFunc =
-            [this, &allMsgs, &setExtraInfoFunc]()
+            [this, &garbage, &allMsgs, &setExtraInfoFunc]()
             {
-                if (!m_garbage.empty()) {
+                if (!garbage.empty()) {
                     MessagePtr invalidMsgPtr(new InvalidMsg());
                     setNameToMessageProperties(*invalidMsgPtr);
                     std::unique_ptr<RawDataMsg> rawDataMsgPtr(new RawDataMsg());
-                    ReadIterator garbageReadIterator = &m_garbage[0];
-                    auto esTmp = rawDataMsgPtr->read(garbageReadIterator, m_garbage.size());
+                    ReadIterator garbageReadIterator = &garbage[0];
+                    auto esTmp = rawDataMsgPtr->read(garbageReadIterator, garbage.size());
                     static_cast<void>(esTmp);
                     assert(esTmp == comms::ErrorStatus::Success);
                     setRawDataToMessageProperties(MessagePtr(rawDataMsgPtr.release()), *invalidMsgPtr);
                     setExtraInfoFunc(*invalidMsgPtr);
                     allMsgs.push_back(std::move(invalidMsgPtr));
-                    m_garbage.clear();
+                    garbage.clear();
                 }
             };
 
@@ -250,26 +256,77 @@ protected:
             }
 
             // Protocol error
-            m_garbage.push_back(*readIterBeg);
+            garbage.push_back(*readIterBeg);
             static const std::size_t GarbageLimit = 512;
-            if (GarbageLimit <= m_garbage.size()) {
+            if (GarbageLimit <= garbage.size()) {
                 checkGarbageFunc();
             }
             ++readIterBeg;
         }
 
         if (final) {
-            ReadIterator dataBegin = &m_data[0];
+            ReadIterator dataBegin = &data[0];
             auto consumed =
                 static_cast<std::size_t>(std::distance(dataBegin, readIterBeg));
-            auto remDataCount = m_data.size() - consumed;
-            m_garbage.insert(m_garbage.end(), m_data.begin() + consumed, m_data.end());
+            auto remDataCount = data.size() - consumed;
+            garbage.insert(garbage.end(), data.begin() + consumed, data.end());
             std::advance(readIterBeg, remDataCount);
             checkGarbageFunc();
         }
         return allMsgs;
     }
 
+    /// @brief Overriding implementation to Protocol::canFindFrameStartImpl().
+    virtual bool canFindFrameStartImpl() const override
+    {
+        return true;
+    }
+
+    /// @brief Overriding implementation to Protocol::findFrameStartImpl().
+    /// @details Tries to read a frame using the protocol stack at every
+    ///     offset below @b maxOffset. The offset is accepted when the frame
+    ///     is successfully read and the frame following it (if any) is also
+    ///     recognised, which filters out false positives in the middle of
+    ///     the payload.
+    virtual std::size_t findFrameStartImpl(
+        const std::uint8_t* data,
+        std::size_t size,
+        std::size_t maxOffset) override
+    {
+        using ReadIterator = typename ProtocolMessage::ReadIterator;
+
+        auto isFrameFunc =
+            [](comms::ErrorStatus es) -> bool
+            {
+                return (es == comms::ErrorStatus::Success) ||
+                       (es == comms::ErrorStatus::InvalidMsgData);
+            };
+
+        for (std::size_t offset = 0U; offset < maxOffset; ++offset) {
+            ReadIterator const frameBeg = data + offset;
+            ReadIterator readIter = frameBeg;
+            auto remSize = size - offset;
+            ProtocolMsgPtr msgPtr;
+            auto es = m_protStack.read(msgPtr, readIter, remSize);
+            if (!isFrameFunc(es)) {
+                continue;
+            }
+
+            auto consumed =
+                static_cast<std::size_t>(std::distance(frameBeg, readIter));
+            if ((consumed == 0U) || (remSize <= consumed)) {
+                return offset;
+            }
+
+            ProtocolMsgPtr nextMsgPtr;
+            es = m_protStack.read(nextMsgPtr, readIter, remSize - consumed);
+            if (isFrameFunc(es) || (es == comms::ErrorStatus::NotEnoughData)) {
+                return offset;
+            }
+        }
+        return size;
+    }
+
     /// @brief Overriding implementation to Protocol::writeImpl().
     virtual DataInfoPtr writeImpl(Message& msg) override
     {
@@ -471,6 +528,8 @@ protected:
     }
 
 private:
+    typedef std::chrono::steady_clock StreamClock;
+
     struct NumericIdTag {};
     struct OtherIdTag {};
 
@@ -566,9 +625,88 @@ private:
         return result;
     }
 
+    struct StreamContext
+    {
+        DataInfo::StreamKey m_key = 0U;
+        std::vector<std::uint8_t> m_data;
+        std::vector<std::uint8_t> m_garbage;
+        StreamClock::time_point m_lastUsed;
+    };
+
+    typedef std::vector<StreamContext> StreamContextsList;
+
+    StreamContext& streamContext(DataInfo::StreamKey key)
+    {
+        auto now = StreamClock::now();
+        auto findStreamFunc =
+            [this, key]() -> typename StreamContextsList::iterator
+            {
+                return
+                    std::lower_bound(
+                        m_streams.begin(), m_streams.end(), key,
+                        [](const StreamContext& stream, DataInfo::StreamKey val) -> bool
+                        {
+                            return stream.m_key < val;
+                        });
+            };
+
+        auto iter = findStreamFunc();
+        if ((iter != m_streams.end()) && (iter->m_key == key)) {
+            iter->m_lastUsed = now;
+            return *iter;
+        }
+
+        if (evictIdleStreams(now)) {
+            // Insertion position is invalidated by the removal
+            iter = findStreamFunc();
+        }
+
+        StreamContext stream;
+        stream.m_key = key;
+        stream.m_lastUsed = now;
+        return *m_streams.insert(iter, std::move(stream));
+    }
+
+    bool evictIdleStreams(StreamClock::time_point now)
+    {
+        static const auto IdleTimeout = std::chrono::seconds(60);
+        static const std::size_t MaxStreams = 256U;
+
+        auto oldSize = m_streams.size();
+        m_streams.erase(
+            std::remove_if(
+                m_streams.begin(), m_streams.end(),
+                [now](const StreamContext& stream) -> bool
+                {
+                    return (stream.m_key != 0U) &&
+                           ((stream.m_lastUsed + IdleTimeout) < now);
+                }),
+            m_streams.end());
+
+        if (MaxStreams <= m_streams.size()) {
+            // Too many active streams, drop the least recently used one,
+            // the default stream (key 0) is kept, it's always first when present.
+            auto searchBegin = m_streams.begin();
+            if (searchBegin->m_key == 0U) {
+                ++searchBegin;
+            }
+
+            auto lruIter =
+                std::min_element(
+                    searchBegin, m_streams.end(),
+                    [](const StreamContext& first, const StreamContext& second) -> bool
+                    {
+                        return first.m_lastUsed < second.m_lastUsed;
+                    });
+            assert(lruIter != m_streams.end());
+            m_streams.erase(lruIter);
+        }
+
+        return m_streams.size() != oldSize;
+    }
+
     ProtocolStack m_protStack;
-    std::vector<std::uint8_t> m_data;
-    std::vector<std::uint8_t> m_garbage;
+    StreamContextsList m_streams;
 };
 
 }  // namespace comms_champion
@@ -138,6 +138,13 @@ public:
     ///     explicty user request.
     /// @return OR-ed values of @ref ConnectionProperty values.
     unsigned connectionProperties() const;
+
+    /// @brief Get number of bytes accepted by sendData(), but not written
+    ///     to the I/O link yet.
+    /// @details Allows the driving application to detect back-pressure.
+    ///     The function invokes virtual pendingSendBytesImpl(), which can
+    ///     be overridden by the derived class.
+    std::size_t pendingSendBytes() const;
 protected:
     /// @brief Polymorphic start functionality implementation.
     /// @details Invoked by start() and default implementation does nothing.
@@ -172,6 +179,12 @@ protected:
     /// @return 0.
     virtual unsigned connectionPropertiesImpl() const;
 
+    /// @brief Polymorphic pending bytes calculation functionality implementation.
+    /// @details Invoked by pendingSendBytes(). In can be overriden by the
+    ///     derived class.
+    /// @return 0.
+    virtual std::size_t pendingSendBytesImpl() const;
+
     /// @brief Report new data has been received.
     /// @details This function needs to be invoked by the derived class when
     ///     new data has been received from the I/O link. This function
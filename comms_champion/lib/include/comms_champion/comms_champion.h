@@ -37,6 +37,7 @@
 #include "InvalidMessage.h"
 #include "MsgMgr.h"
 #include "MsgFileMgr.h"
+#include "ParallelParser.h"
 #include "MsgSendMgr.h"
 #include "StaticSingleton.h"
 #include "property/message.h"
@@ -81,6 +81,7 @@ protected:
     virtual Ptr cloneImpl() = 0;
     virtual void refreshMembersImpl() = 0;
     virtual PrefixFieldInfo getPrefixFieldInfoImpl() const = 0;
+    virtual bool rebindMembersImpl(FieldWrapper& other) override;
 
     void dispatchImpl(FieldWrapperHandler& handler);
 
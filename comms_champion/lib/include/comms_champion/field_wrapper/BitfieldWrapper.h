@@ -58,6 +58,7 @@ public:
 
 protected:
     virtual Ptr cloneImpl() = 0;
+    virtual bool rebindMembersImpl(FieldWrapper& other) override;
 
     void dispatchImpl(FieldWrapperHandler& handler);
 
@@ -57,6 +57,7 @@ public:
 
 protected:
     virtual Ptr cloneImpl() = 0;
+    virtual bool rebindMembersImpl(FieldWrapper& other) override;
 
     void dispatchImpl(FieldWrapperHandler& handler);
 
@@ -68,6 +68,8 @@ public:
 
     BasePtr upClone();
 
+    bool rebind(FieldWrapper& other);
+
 protected:
     virtual std::size_t lengthImpl() const = 0;
     virtual bool validImpl() const = 0;
@@ -75,6 +77,8 @@ protected:
     virtual bool setSerialisedValueImpl(const SerialisedSeq& value) = 0;
     virtual void dispatchImpl(FieldWrapperHandler& handler) = 0;
     virtual BasePtr upCloneImpl() = 0;
+    virtual bool rebindImpl(FieldWrapper& other) = 0;
+    virtual bool rebindMembersImpl(FieldWrapper& other);
 };
 
 template <typename TBase, typename TField>
@@ -96,39 +100,39 @@ protected:
     using Field = TField;
 
     explicit FieldWrapperT(Field& fieldRef)
-      : m_field(fieldRef)
+      : m_field(&fieldRef)
     {
     }
 
     virtual std::size_t lengthImpl() const override
     {
-        return m_field.length();
+        return m_field->length();
     }
 
     virtual bool validImpl() const override
     {
-        return m_field.valid();
+        return m_field->valid();
     }
 
     Field& field()
     {
-        return m_field;
+        return *m_field;
     }
 
     const Field& field() const
     {
-        return m_field;
+        return *m_field;
     }
 
     virtual SerialisedSeq getSerialisedValueImpl() const override
     {
         SerialisedSeq seq;
-        seq.reserve(m_field.length());
+        seq.reserve(m_field->length());
         auto iter = std::back_inserter(seq);
-        auto es = m_field.write(iter, seq.max_size());
+        auto es = m_field->write(iter, seq.max_size());
         static_cast<void>(es);
         assert(es == comms::ErrorStatus::Success);
-        assert(seq.size() == m_field.length());
+        assert(seq.size() == m_field->length());
         return seq;
     }
 
@@ -142,7 +146,7 @@ protected:
             (!Field::ParsedOptions::HasSequenceTrailingFieldSuffix) &&
             (!Field::ParsedOptions::HasSequenceTerminationFieldSuffix)){
             auto iter = &value[0];
-            auto es = m_field.read(iter, value.size());
+            auto es = m_field->read(iter, value.size());
             return es == comms::ErrorStatus::Success;
         }
 
@@ -163,7 +167,7 @@ protected:
         }
 
         auto iter = &newVal[0];
-        auto es = m_field.read(iter, newVal.size());
+        auto es = m_field->read(iter, newVal.size());
         return es == comms::ErrorStatus::Success;
     }
 
@@ -172,6 +176,17 @@ protected:
         return static_cast<Base*>(this)->clone();
     }
 
+    virtual bool rebindImpl(FieldWrapper& other) override
+    {
+        auto* otherWrapper = dynamic_cast<FieldWrapperT*>(&other);
+        if (otherWrapper == nullptr) {
+            return false;
+        }
+
+        m_field = otherWrapper->m_field;
+        return true;
+    }
+
 private:
     typedef typename std::conditional<
         Field::ParsedOptions::HasSequenceSizeFieldPrefix,
@@ -239,7 +254,7 @@ private:
     }
 
 
-    Field& m_field;
+    Field* m_field = nullptr;
 };
 
 typedef FieldWrapper::BasePtr FieldWrapperPtr;
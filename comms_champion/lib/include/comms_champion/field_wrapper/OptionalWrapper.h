@@ -57,6 +57,7 @@ protected:
     virtual Mode getModeImpl() const = 0;
     virtual void setModeImpl(Mode mode) = 0;
     virtual Ptr cloneImpl() = 0;
+    virtual bool rebindMembersImpl(FieldWrapper& other) override;
 
     void dispatchImpl(FieldWrapperHandler& handler);
 
@@ -71,6 +71,7 @@ public:
 
 protected:
     virtual Ptr cloneImpl() = 0;
+    virtual bool rebindMembersImpl(FieldWrapper& other) override;
 
     virtual void dispatchImpl(FieldWrapperHandler& handler);
     virtual int getCurrentIndexImpl() const = 0;
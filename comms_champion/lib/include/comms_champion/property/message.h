@@ -246,6 +246,17 @@ private:
     static const QByteArray PropName;
 };
 
+class CC_API FrameCacheKey : public PropBase<unsigned long long>
+{
+    typedef PropBase<unsigned long long> Base;
+public:
+    FrameCacheKey() : Base(Name, PropName) {};
+
+private:
+    static const QString Name;
+    static const QByteArray PropName;
+};
+
 class CC_API ScrollPos : public PropBase<int>
 {
     typedef PropBase<int> Base;
@@ -0,0 +1,230 @@
+//
+// Copyright 2017 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#include "DecodePool.h"
+
+#include <cassert>
+#include <algorithm>
+#include <thread>
+
+#include "comms/CompileControl.h"
+
+CC_DISABLE_WARNINGS()
+#include <QtCore/QMetaObject>
+CC_ENABLE_WARNINGS()
+
+namespace comms_champion
+{
+
+namespace
+{
+
+const auto ContextIdleTimeout = std::chrono::seconds(60);
+
+}  // namespace
+
+DecodePool::DecodePool(ProtocolCreateFunc createFunc, unsigned threadsCount)
+  : m_createFunc(std::move(createFunc)),
+    m_lastEviction(Clock::now()),
+    m_notifyPending(false)
+{
+    assert(m_createFunc);
+    if (threadsCount == 0U) {
+        threadsCount = std::max(std::thread::hardware_concurrency(), 2U) - 1U;
+    }
+
+    m_workers.resize(threadsCount);
+    for (auto& state : m_workers) {
+        state.m_worker.reset(
+            new DecodeWorker(
+                [this]()
+                {
+                    notifyDecoded();
+                }));
+    }
+}
+
+DecodePool::~DecodePool()
+{
+    // Workers must be stopped before the contexts are destructed
+    m_workers.clear();
+}
+
+bool DecodePool::pushData(DataInfoPtr dataPtr)
+{
+    assert(dataPtr);
+    auto* context = getContext(dataPtr->m_streamKey);
+    if (context == nullptr) {
+        ++m_droppedCount;
+        return false;
+    }
+
+    assert(context->m_workerIdx < m_workers.size());
+    auto& state = m_workers[context->m_workerIdx];
+    auto timestamp = dataPtr->m_timestamp;
+    if (!state.m_worker->pushData(std::move(dataPtr), context->m_protocol)) {
+        return false;
+    }
+
+    state.m_inFlight.push_back(timestamp);
+    return true;
+}
+
+unsigned long long DecodePool::droppedCount() const
+{
+    auto count = m_droppedCount;
+    for (auto& state : m_workers) {
+        count += state.m_worker->droppedCount();
+    }
+    return count;
+}
+
+std::size_t DecodePool::queuedCount() const
+{
+    std::size_t count = 0U;
+    for (auto& state : m_workers) {
+        count += state.m_worker->queuedCount() + state.m_staged.size();
+    }
+    return count;
+}
+
+void DecodePool::processDecoded()
+{
+    m_notifyPending = false;
+    for (auto& state : m_workers) {
+        collect(state);
+    }
+
+    while (true) {
+        WorkerState* next = nullptr;
+        for (auto& state : m_workers) {
+            if (state.m_staged.empty()) {
+                continue;
+            }
+
+            if ((next == nullptr) ||
+                (state.m_staged.front().m_timestamp < next->m_staged.front().m_timestamp)) {
+                next = &state;
+            }
+        }
+
+        if (next == nullptr) {
+            break;
+        }
+
+        // The worker that is still decoding data received earlier may
+        // produce messages that need to be reported first.
+        auto& timestamp = next->m_staged.front().m_timestamp;
+        auto blocked =
+            std::any_of(
+                m_workers.begin(), m_workers.end(),
+                [&timestamp](const WorkerState& state) -> bool
+                {
+                    return
+                        state.m_staged.empty() &&
+                        (!state.m_inFlight.empty()) &&
+                        (state.m_inFlight.front() < timestamp);
+                });
+
+        if (blocked) {
+            break;
+        }
+
+        auto decoded = std::move(next->m_staged.front());
+        next->m_staged.pop_front();
+        if (m_msgDecodedCallback) {
+            m_msgDecodedCallback(std::move(decoded.m_msg), decoded.m_timestamp);
+        }
+    }
+}
+
+DecodePool::Context* DecodePool::getContext(StreamKey key)
+{
+    auto now = Clock::now();
+    auto iter = m_contexts.find(key);
+    if (iter != m_contexts.end()) {
+        iter->second.m_lastUsed = now;
+        return &iter->second;
+    }
+
+    evictIdleContexts(now);
+
+    Context context;
+    context.m_protocol = m_createFunc();
+    if (!context.m_protocol) {
+        return nullptr;
+    }
+
+    assert(!m_workers.empty());
+    context.m_workerIdx = m_nextWorkerIdx;
+    context.m_lastUsed = now;
+    m_nextWorkerIdx = (m_nextWorkerIdx + 1U) % static_cast<unsigned>(m_workers.size());
+
+    auto& inserted = m_contexts[key];
+    inserted = std::move(context);
+    return &inserted;
+}
+
+void DecodePool::evictIdleContexts(Clock::time_point now)
+{
+    if (now < (m_lastEviction + ContextIdleTimeout)) {
+        return;
+    }
+
+    m_lastEviction = now;
+    for (auto iter = m_contexts.begin(); iter != m_contexts.end();) {
+        // The protocol object is shared with the data still queued to
+        // the worker, hence it's safe to remove the context.
+        if ((iter->second.m_lastUsed + ContextIdleTimeout) < now) {
+            iter = m_contexts.erase(iter);
+            continue;
+        }
+        ++iter;
+    }
+}
+
+void DecodePool::collect(WorkerState& state)
+{
+    // The completed count must be read before the decoded messages are
+    // retrieved, all the messages of the completed data are guaranteed
+    // to be in the queue then.
+    auto completed = state.m_worker->completedCount();
+
+    DecodedMsg decoded;
+    while (state.m_worker->popDecoded(decoded)) {
+        state.m_staged.push_back(std::move(decoded));
+        decoded.m_msg.reset();
+    }
+
+    while (state.m_completed < completed) {
+        assert(!state.m_inFlight.empty());
+        state.m_inFlight.pop_front();
+        ++state.m_completed;
+    }
+}
+
+void DecodePool::notifyDecoded()
+{
+    if (m_notifyPending.exchange(true)) {
+        return;
+    }
+
+    QMetaObject::invokeMethod(this, "processDecoded", Qt::QueuedConnection);
+}
+
+}  // namespace comms_champion
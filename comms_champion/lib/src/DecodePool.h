@@ -0,0 +1,111 @@
+//
+// Copyright 2017 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#pragma once
+
+#include <memory>
+#include <vector>
+#include <deque>
+#include <map>
+#include <atomic>
+#include <chrono>
+#include <functional>
+
+#include "comms/CompileControl.h"
+
+CC_DISABLE_WARNINGS()
+#include <QtCore/QObject>
+CC_ENABLE_WARNINGS()
+
+#include "comms_champion/Protocol.h"
+#include "comms_champion/DataInfo.h"
+#include "DecodeWorker.h"
+
+namespace comms_champion
+{
+
+/// @brief Decodes incoming data on multiple worker threads.
+/// @details Every stream (see DataInfo::m_streamKey) gets its own
+///     decode context with separate protocol instance, which is bound
+///     to one of the workers. The decoded messages are merged back
+///     in timestamp order and reported in the thread which created
+///     the pool.
+class DecodePool : public QObject
+{
+    Q_OBJECT
+    typedef QObject Base;
+public:
+    typedef std::function<ProtocolPtr ()> ProtocolCreateFunc;
+    typedef std::function<void (MessagePtr msg, const DataInfo::Timestamp& timestamp)> MsgDecodedCallbackFunc;
+
+    DecodePool(ProtocolCreateFunc createFunc, unsigned threadsCount);
+    ~DecodePool();
+
+    template <typename TFunc>
+    void setMsgDecodedCallbackFunc(TFunc&& func)
+    {
+        m_msgDecodedCallback = std::forward<TFunc>(func);
+    }
+
+    bool pushData(DataInfoPtr dataPtr);
+
+    unsigned long long droppedCount() const;
+
+    std::size_t queuedCount() const;
+
+private slots:
+    void processDecoded();
+
+private:
+    typedef std::chrono::steady_clock Clock;
+    typedef DataInfo::StreamKey StreamKey;
+    typedef DecodeWorker::DecodedMsg DecodedMsg;
+
+    struct Context
+    {
+        ProtocolPtr m_protocol;
+        unsigned m_workerIdx = 0U;
+        Clock::time_point m_lastUsed;
+    };
+
+    struct WorkerState
+    {
+        std::unique_ptr<DecodeWorker> m_worker;
+        std::deque<DataInfo::Timestamp> m_inFlight;
+        std::deque<DecodedMsg> m_staged;
+        unsigned long long m_completed = 0U;
+    };
+
+    typedef std::map<StreamKey, Context> ContextsMap;
+
+    Context* getContext(StreamKey key);
+    void evictIdleContexts(Clock::time_point now);
+    void collect(WorkerState& state);
+    void notifyDecoded();
+
+    ProtocolCreateFunc m_createFunc;
+    std::vector<WorkerState> m_workers;
+    ContextsMap m_contexts;
+    unsigned m_nextWorkerIdx = 0U;
+    unsigned long long m_droppedCount = 0U;
+    Clock::time_point m_lastEviction;
+    std::atomic<bool> m_notifyPending;
+    MsgDecodedCallbackFunc m_msgDecodedCallback;
+};
+
+}  // namespace comms_champion
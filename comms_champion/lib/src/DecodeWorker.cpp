@@ -0,0 +1,148 @@
+//
+// Copyright 2017 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#include "DecodeWorker.h"
+
+#include <cassert>
+
+#include "MsgThread.h"
+
+namespace comms_champion
+{
+
+DecodeWorker::DecodeWorker(NotifyFunc&& notifyFunc)
+  : m_notifyFunc(std::move(notifyFunc)),
+    m_completedCount(0U),
+    m_running(true),
+    m_waitingForSpace(false),
+    m_ownerThread(QThread::currentThread())
+{
+    assert(m_notifyFunc);
+    m_thread = std::thread(
+        [this]()
+        {
+            run();
+        });
+}
+
+DecodeWorker::~DecodeWorker()
+{
+    {
+        std::lock_guard<std::mutex> guard(m_wakeMutex);
+        m_running = false;
+    }
+    m_wakeCond.notify_one();
+    m_spaceCond.notify_one();
+    m_thread.join();
+}
+
+bool DecodeWorker::pushData(DataInfoPtr dataPtr, ProtocolPtr protocol)
+{
+    assert(dataPtr);
+    assert(protocol);
+    DataEntry entry;
+    entry.m_data = std::move(dataPtr);
+    entry.m_protocol = std::move(protocol);
+    if (!m_dataQueue.pushBack(std::move(entry))) {
+        ++m_droppedCount;
+        return false;
+    }
+
+    {
+        // Synchronisation with the waiting worker only, the data itself
+        // is passed via the lock-free queue.
+        std::lock_guard<std::mutex> guard(m_wakeMutex);
+    }
+    m_wakeCond.notify_one();
+    return true;
+}
+
+bool DecodeWorker::popDecoded(DecodedMsg& decoded)
+{
+    if (!m_msgsQueue.popFront(decoded)) {
+        return false;
+    }
+
+    // Pairs with the fence in run(), either the worker sees the freed
+    // space or this thread sees it's waiting for one.
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (m_waitingForSpace.load(std::memory_order_relaxed)) {
+        {
+            std::lock_guard<std::mutex> guard(m_wakeMutex);
+        }
+        m_spaceCond.notify_one();
+    }
+    return true;
+}
+
+void DecodeWorker::run()
+{
+    while (m_running) {
+        DataEntry entry;
+        if (!m_dataQueue.popFront(entry)) {
+            std::unique_lock<std::mutex> lock(m_wakeMutex);
+            m_wakeCond.wait(
+                lock,
+                [this]() -> bool
+                {
+                    return (!m_running) || (!m_dataQueue.empty());
+                });
+            continue;
+        }
+
+        assert(entry.m_data);
+        assert(entry.m_protocol);
+        auto msgs = entry.m_protocol->read(*entry.m_data);
+        for (auto& m : msgs) {
+            assert(m);
+            moveMsgToThread(*m, m_ownerThread);
+
+            DecodedMsg decoded;
+            decoded.m_msg = std::move(m);
+            decoded.m_timestamp = entry.m_data->m_timestamp;
+
+            // Back pressure: wait for the owner thread to consume decoded
+            // messages, the incoming data is dropped in the meantime.
+            while (!m_msgsQueue.pushBack(std::move(decoded))) {
+                m_notifyFunc();
+
+                std::unique_lock<std::mutex> lock(m_wakeMutex);
+                m_waitingForSpace.store(true, std::memory_order_relaxed);
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+                m_spaceCond.wait(
+                    lock,
+                    [this]() -> bool
+                    {
+                        return (!m_running) || (!m_msgsQueue.full());
+                    });
+                m_waitingForSpace.store(false, std::memory_order_relaxed);
+
+                if (!m_running) {
+                    return;
+                }
+            }
+        }
+
+        // All the messages decoded from the entry must be in the queue
+        // before the completion is visible to the owner thread.
+        m_completedCount.fetch_add(1U, std::memory_order_release);
+        m_notifyFunc();
+    }
+}
+
+}  // namespace comms_champion
@@ -0,0 +1,102 @@
+//
+// Copyright 2017 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#pragma once
+
+#include <thread>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+
+#include "comms/CompileControl.h"
+
+CC_DISABLE_WARNINGS()
+#include <QtCore/QThread>
+CC_ENABLE_WARNINGS()
+
+#include "comms/util/StaticSpscQueue.h"
+#include "comms_champion/Protocol.h"
+#include "comms_champion/DataInfo.h"
+
+namespace comms_champion
+{
+
+class DecodeWorker
+{
+public:
+    typedef std::function<void ()> NotifyFunc;
+
+    struct DecodedMsg
+    {
+        MessagePtr m_msg;
+        DataInfo::Timestamp m_timestamp;
+    };
+
+    explicit DecodeWorker(NotifyFunc&& notifyFunc);
+    ~DecodeWorker();
+
+    bool pushData(DataInfoPtr dataPtr, ProtocolPtr protocol);
+
+    bool popDecoded(DecodedMsg& decoded);
+
+    unsigned long long completedCount() const
+    {
+        return m_completedCount.load(std::memory_order_acquire);
+    }
+
+    unsigned long long droppedCount() const
+    {
+        return m_droppedCount;
+    }
+
+    std::size_t queuedCount() const
+    {
+        return m_dataQueue.size() + m_msgsQueue.size();
+    }
+
+private:
+    struct DataEntry
+    {
+        DataInfoPtr m_data;
+        ProtocolPtr m_protocol;
+    };
+
+    static const std::size_t DataQueueCapacity = 1024U;
+    static const std::size_t MsgsQueueCapacity = 8192U;
+
+    typedef comms::util::StaticSpscQueue<DataEntry, DataQueueCapacity> DataQueue;
+    typedef comms::util::StaticSpscQueue<DecodedMsg, MsgsQueueCapacity> MsgsQueue;
+
+    void run();
+
+    NotifyFunc m_notifyFunc;
+    DataQueue m_dataQueue;
+    MsgsQueue m_msgsQueue;
+    unsigned long long m_droppedCount = 0U;
+    std::atomic<unsigned long long> m_completedCount;
+    std::atomic<bool> m_running;
+    std::mutex m_wakeMutex;
+    std::condition_variable m_wakeCond;
+    std::condition_variable m_spaceCond;
+    std::atomic<bool> m_waitingForSpace;
+    QThread* m_ownerThread = nullptr;
+    std::thread m_thread;
+};
+
+}  // namespace comms_champion
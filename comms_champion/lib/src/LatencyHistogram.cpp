@@ -0,0 +1,180 @@
+//
+// Copyright 2017 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#include "comms_champion/LatencyHistogram.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cassert>
+
+namespace comms_champion
+{
+
+namespace
+{
+
+const unsigned SubBucketBits = 6U;
+const std::size_t SubBucketsCount = 1U << SubBucketBits;
+const unsigned LinearBits = SubBucketBits + 1U;
+const std::size_t LinearCount = 1U << LinearBits;
+const unsigned MaxValueBits = 40U;
+const LatencyHistogram::ValueType MaxValue =
+    (LatencyHistogram::ValueType(1U) << MaxValueBits) - 1U;
+const std::size_t BucketsCount =
+    LinearCount + ((MaxValueBits - LinearBits) * SubBucketsCount);
+
+unsigned mostSignificantBit(LatencyHistogram::ValueType value)
+{
+    assert(value != 0U);
+    unsigned result = 0U;
+    for (unsigned shift = 32U; 0U < shift; shift /= 2U) {
+        if ((value >> shift) != 0U) {
+            value >>= shift;
+            result += shift;
+        }
+    }
+    return result;
+}
+
+}  // namespace
+
+LatencyHistogram::LatencyHistogram()
+  : m_buckets(BucketsCount, 0U)
+{
+}
+
+void LatencyHistogram::record(ValueType value)
+{
+    value = std::min(value, MaxValue);
+    ++m_buckets[bucketIdx(value)];
+    if ((m_count == 0U) || (value < m_min)) {
+        m_min = value;
+    }
+
+    m_max = std::max(m_max, value);
+    m_sum += static_cast<double>(value);
+    ++m_count;
+}
+
+void LatencyHistogram::merge(const LatencyHistogram& other)
+{
+    if (other.m_count == 0U) {
+        return;
+    }
+
+    assert(m_buckets.size() == other.m_buckets.size());
+    for (std::size_t idx = 0U; idx < m_buckets.size(); ++idx) {
+        m_buckets[idx] += other.m_buckets[idx];
+    }
+
+    if ((m_count == 0U) || (other.m_min < m_min)) {
+        m_min = other.m_min;
+    }
+
+    m_max = std::max(m_max, other.m_max);
+    m_sum += other.m_sum;
+    m_count += other.m_count;
+}
+
+void LatencyHistogram::reset()
+{
+    std::fill(m_buckets.begin(), m_buckets.end(), 0U);
+    m_count = 0U;
+    m_min = 0U;
+    m_max = 0U;
+    m_sum = 0.0;
+}
+
+std::uint64_t LatencyHistogram::count() const
+{
+    return m_count;
+}
+
+LatencyHistogram::ValueType LatencyHistogram::min() const
+{
+    return m_min;
+}
+
+LatencyHistogram::ValueType LatencyHistogram::max() const
+{
+    return m_max;
+}
+
+double LatencyHistogram::mean() const
+{
+    if (m_count == 0U) {
+        return 0.0;
+    }
+
+    return m_sum / static_cast<double>(m_count);
+}
+
+LatencyHistogram::ValueType LatencyHistogram::valueAtPercentile(double percentile) const
+{
+    if (m_count == 0U) {
+        return 0U;
+    }
+
+    percentile = std::max(0.0, std::min(percentile, 100.0));
+    auto target =
+        static_cast<std::uint64_t>(
+            std::ceil((percentile / 100.0) * static_cast<double>(m_count)));
+    target = std::max(target, std::uint64_t(1U));
+
+    std::uint64_t accumulated = 0U;
+    for (std::size_t idx = 0U; idx < m_buckets.size(); ++idx) {
+        accumulated += m_buckets[idx];
+        if (target <= accumulated) {
+            return std::max(m_min, std::min(bucketValue(idx), m_max));
+        }
+    }
+
+    return m_max;
+}
+
+std::size_t LatencyHistogram::bucketIdx(ValueType value)
+{
+    if (value < LinearCount) {
+        return static_cast<std::size_t>(value);
+    }
+
+    auto msb = mostSignificantBit(value);
+    assert(LinearBits <= msb);
+    auto shift = msb - SubBucketBits;
+    auto subIdx = static_cast<std::size_t>(value >> shift) - SubBucketsCount;
+    assert(subIdx < SubBucketsCount);
+    return LinearCount + ((msb - LinearBits) * SubBucketsCount) + subIdx;
+}
+
+LatencyHistogram::ValueType LatencyHistogram::bucketValue(std::size_t idx)
+{
+    if (idx < LinearCount) {
+        return static_cast<ValueType>(idx);
+    }
+
+    auto rem = idx - LinearCount;
+    auto msb = static_cast<unsigned>(LinearBits + (rem / SubBucketsCount));
+    auto shift = msb - SubBucketBits;
+    auto sub = static_cast<ValueType>(SubBucketsCount + (rem % SubBucketsCount));
+
+    // Highest value that falls into the bucket
+    return ((sub + 1U) << shift) - 1U;
+}
+
+}  // namespace comms_champion
+
@@ -598,11 +598,18 @@ void MsgFileMgr::addToRecvSave(
     FileSaveHandler handler,
     const Message& msg,
     bool flush)
+{
+    addToRecvSave(std::move(handler), convertRecvMsg(msg), flush);
+}
+
+void MsgFileMgr::addToRecvSave(
+    FileSaveHandler handler,
+    const QVariantMap& msgInfo,
+    bool flush)
 {
     assert(handler);
-    auto msgMap = convertRecvMsg(msg);
-    if (!msgMap.isEmpty()) {
-        auto jsonObj = QJsonObject::fromVariantMap(msgMap);
+    if (!msgInfo.isEmpty()) {
+        auto jsonObj = QJsonObject::fromVariantMap(msgInfo);
         QJsonDocument jsonDoc(jsonObj);
         auto data = jsonDoc.toJson();
         assert(!data.isEmpty());
@@ -629,6 +636,11 @@ void MsgFileMgr::addToRecvSave(
     }
 }
 
+QVariantMap MsgFileMgr::recvMsgInfo(const Message& msg)
+{
+    return convertRecvMsg(msg);
+}
+
 void MsgFileMgr::flushRecvFile(FileSaveHandler handler)
 {
     assert(handler);
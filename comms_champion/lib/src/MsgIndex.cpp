@@ -0,0 +1,210 @@
+//
+// Copyright 2017 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#include "MsgIndex.h"
+
+#include <cassert>
+#include <algorithm>
+
+#include "comms_champion/MessageHandler.h"
+#include "comms_champion/field_wrapper/FieldWrapperHandler.h"
+
+namespace comms_champion
+{
+
+namespace
+{
+
+class FieldValueRetriever : public field_wrapper::FieldWrapperHandler
+{
+public:
+    virtual void handle(field_wrapper::IntValueWrapper& wrapper) override
+    {
+        m_value = QString::number(wrapper.getValue());
+    }
+
+    virtual void handle(field_wrapper::UnsignedLongValueWrapper& wrapper) override
+    {
+        m_value = QString::number(wrapper.getValue());
+    }
+
+    virtual void handle(field_wrapper::BitmaskValueWrapper& wrapper) override
+    {
+        m_value = QString::number(wrapper.getValue());
+    }
+
+    virtual void handle(field_wrapper::EnumValueWrapper& wrapper) override
+    {
+        m_value = QString::number(wrapper.getValue());
+    }
+
+    virtual void handle(field_wrapper::FloatValueWrapper& wrapper) override
+    {
+        m_value = QString::number(wrapper.getValue());
+    }
+
+    virtual void handle(field_wrapper::StringWrapper& wrapper) override
+    {
+        m_value = wrapper.getValue();
+    }
+
+    virtual void handle(field_wrapper::FieldWrapper& wrapper) override
+    {
+        m_value = wrapper.getSerialisedString();
+    }
+
+    const QString& getValue() const
+    {
+        return m_value;
+    }
+
+private:
+    QString m_value;
+};
+
+class FieldValueHandler : public MessageHandler
+{
+public:
+    explicit FieldValueHandler(int fieldIdx)
+      : m_fieldIdx(fieldIdx)
+    {
+    }
+
+    const QString& getValue() const
+    {
+        return m_value;
+    }
+
+protected:
+    virtual void addFieldImpl(FieldWrapperPtr wrapper) override
+    {
+        if (m_currIdx == m_fieldIdx) {
+            assert(wrapper);
+            FieldValueRetriever retriever;
+            wrapper->dispatch(retriever);
+            m_value = retriever.getValue();
+        }
+        ++m_currIdx;
+    }
+
+private:
+    int m_fieldIdx = 0;
+    int m_currIdx = 0;
+    QString m_value;
+};
+
+}  // namespace
+
+void MsgIndex::add(SeqNumType seqNum, Message& msg)
+{
+    auto id = msg.idAsString();
+    auto& postings = m_ids[id];
+    assert(postings.empty() || (postings.back() < seqNum));
+    postings.push_back(seqNum);
+
+    auto iter = m_fieldsIdx.lower_bound(FieldKey(id, 0));
+    for (; (iter != m_fieldsIdx.end()) && (iter->first.first == id); ++iter) {
+        auto& valuePostings = iter->second[fieldValue(msg, iter->first.second)];
+        valuePostings.push_back(seqNum);
+    }
+}
+
+void MsgIndex::remove(SeqNumType seqNum, Message& msg)
+{
+    auto id = msg.idAsString();
+    auto idIter = m_ids.find(id);
+    if (idIter == m_ids.end()) {
+        return;
+    }
+
+    removeFrom(idIter->second, seqNum);
+    if (idIter->second.empty()) {
+        m_ids.erase(idIter);
+    }
+
+    auto iter = m_fieldsIdx.lower_bound(FieldKey(id, 0));
+    for (; (iter != m_fieldsIdx.end()) && (iter->first.first == id); ++iter) {
+        auto valueIter = iter->second.find(fieldValue(msg, iter->first.second));
+        if (valueIter == iter->second.end()) {
+            continue;
+        }
+
+        removeFrom(valueIter->second, seqNum);
+        if (valueIter->second.empty()) {
+            iter->second.erase(valueIter);
+        }
+    }
+}
+
+void MsgIndex::clear()
+{
+    m_ids.clear();
+    m_fieldsIdx.clear();
+}
+
+const MsgIndex::Postings* MsgIndex::idPostings(const QString& id) const
+{
+    auto iter = m_ids.find(id);
+    if (iter == m_ids.end()) {
+        return nullptr;
+    }
+
+    return &iter->second;
+}
+
+bool MsgIndex::hasFieldIndex(const QString& id, int fieldIdx) const
+{
+    return m_fieldsIdx.find(FieldKey(id, fieldIdx)) != m_fieldsIdx.end();
+}
+
+const MsgIndex::Postings* MsgIndex::fieldPostings(
+    const QString& id,
+    int fieldIdx,
+    const QString& value) const
+{
+    auto iter = m_fieldsIdx.find(FieldKey(id, fieldIdx));
+    if (iter == m_fieldsIdx.end()) {
+        return nullptr;
+    }
+
+    auto valueIter = iter->second.find(value);
+    if (valueIter == iter->second.end()) {
+        return nullptr;
+    }
+
+    return &valueIter->second;
+}
+
+QString MsgIndex::fieldValue(Message& msg, int fieldIdx)
+{
+    FieldValueHandler handler(fieldIdx);
+    msg.dispatch(handler);
+    return handler.getValue();
+}
+
+void MsgIndex::removeFrom(Postings& postings, SeqNumType seqNum)
+{
+    auto iter = std::lower_bound(postings.begin(), postings.end(), seqNum);
+    if ((iter == postings.end()) || (*iter != seqNum)) {
+        return;
+    }
+
+    postings.erase(iter);
+}
+
+}  // namespace comms_champion
@@ -0,0 +1,98 @@
+//
+// Copyright 2017 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#pragma once
+
+#include <map>
+#include <vector>
+#include <utility>
+
+#include "comms/CompileControl.h"
+
+CC_DISABLE_WARNINGS()
+#include <QtCore/QString>
+CC_ENABLE_WARNINGS()
+
+#include "comms_champion/Message.h"
+
+namespace comms_champion
+{
+
+/// @brief Incrementally maintained index of the stored messages.
+/// @details Keeps sorted lists (postings) of sequence numbers of the
+///     messages per message ID and, for the requested fields only,
+///     per textual value of the field. Sequence numbers are
+///     expected to be added in increasing order.
+class MsgIndex
+{
+public:
+    typedef unsigned long long SeqNumType;
+    typedef std::vector<SeqNumType> Postings;
+
+    void add(SeqNumType seqNum, Message& msg);
+    void remove(SeqNumType seqNum, Message& msg);
+    void clear();
+
+    const Postings* idPostings(const QString& id) const;
+
+    bool hasFieldIndex(const QString& id, int fieldIdx) const;
+
+    /// @brief Create index of the field values for messages with specified ID.
+    /// @details The @b func is expected to return pointer to the stored
+    ///     message having provided sequence number.
+    template <typename TFunc>
+    void addFieldIndex(const QString& id, int fieldIdx, TFunc&& func)
+    {
+        auto& valuesMap = m_fieldsIdx[FieldKey(id, fieldIdx)];
+        valuesMap.clear();
+
+        auto* postings = idPostings(id);
+        if (postings == nullptr) {
+            return;
+        }
+
+        for (auto seqNum : *postings) {
+            Message* msg = func(seqNum);
+            if (msg == nullptr) {
+                continue;
+            }
+
+            valuesMap[fieldValue(*msg, fieldIdx)].push_back(seqNum);
+        }
+    }
+
+    const Postings* fieldPostings(
+        const QString& id,
+        int fieldIdx,
+        const QString& value) const;
+
+    static QString fieldValue(Message& msg, int fieldIdx);
+
+private:
+    typedef std::pair<QString, int> FieldKey;
+    typedef std::map<QString, Postings> ValuesMap;
+    typedef std::map<FieldKey, ValuesMap> FieldsIdxMap;
+    typedef std::map<QString, Postings> IdsMap;
+
+    static void removeFrom(Postings& postings, SeqNumType seqNum);
+
+    IdsMap m_ids;
+    FieldsIdxMap m_fieldsIdx;
+};
+
+}  // namespace comms_champion
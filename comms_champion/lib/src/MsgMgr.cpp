@@ -18,6 +18,10 @@
 
 #include "comms_champion/MsgMgr.h"
 
+#include <cassert>
+#include <type_traits>
+#include <atomic>
+
 #include "MsgMgrImpl.h"
 
 namespace comms_champion
@@ -60,6 +64,11 @@ void MsgMgr::setRecvEnabled(bool enabled)
     m_impl->setRecvEnabled(enabled);
 }
 
+void MsgMgr::setStoreMsgsEnabled(bool enabled)
+{
+    m_impl->setStoreMsgsEnabled(enabled);
+}
+
 void MsgMgr::deleteMsg(MessagePtr msg)
 {
     m_impl->deleteMsg(std::move(msg));
@@ -75,6 +84,22 @@ void MsgMgr::sendMsgs(MessagesList&& msgs)
     m_impl->sendMsgs(std::move(msgs));
 }
 
+void MsgMgr::setSendFramePatchFunc(SendFramePatchFunc&& func)
+{
+    m_impl->setSendFramePatchFunc(std::move(func));
+}
+
+void MsgMgr::clearFrameCache()
+{
+    m_impl->clearFrameCache();
+}
+
+unsigned long long MsgMgr::allocFrameCacheKey()
+{
+    static std::atomic<unsigned long long> NextKey(1U);
+    return NextKey.fetch_add(1U);
+}
+
 const MsgMgr::AllMessages& MsgMgr::getAllMsgs() const
 {
     return m_impl->getAllMsgs();
@@ -95,6 +120,61 @@ void MsgMgr::setProtocol(ProtocolPtr protocol)
     m_impl->setProtocol(std::move(protocol));
 }
 
+void MsgMgr::setDecodeProtocolCreateFunc(ProtocolCreateFunc&& func)
+{
+    m_impl->setDecodeProtocolCreateFunc(std::move(func));
+}
+
+MsgMgr::AllMessages MsgMgr::findMsgs(const MsgsQuery& query)
+{
+    return m_impl->findMsgs(query);
+}
+
+bool MsgMgr::msgMatches(Message& msg, const MsgsQuery& query)
+{
+    return MsgMgrImpl::msgMatches(msg, query);
+}
+
+MsgMgr::DecodeStats MsgMgr::getDecodeStats() const
+{
+    return m_impl->getDecodeStats();
+}
+
+void MsgMgr::setLatencyStatsEnabled(bool enabled)
+{
+    m_impl->setLatencyStatsEnabled(enabled);
+}
+
+MsgMgr::LatencyStats MsgMgr::getLatencyStats() const
+{
+    return m_impl->getLatencyStats();
+}
+
+void MsgMgr::resetLatencyStats()
+{
+    m_impl->resetLatencyStats();
+}
+
+const char* MsgMgr::latencyStageName(LatencyStage stage)
+{
+    static const char* Names[] = {
+        "filtered",
+        "decoded",
+        "reported",
+        "callback"
+    };
+
+    static_assert(std::extent<decltype(Names)>::value == LatencyStage_NumOfValues,
+        "Invalid map");
+
+    if (LatencyStage_NumOfValues <= stage) {
+        assert(!"Invalid stage");
+        return "";
+    }
+
+    return Names[stage];
+}
+
 void MsgMgr::addFilter(FilterPtr filter)
 {
     m_impl->addFilter(std::move(filter));
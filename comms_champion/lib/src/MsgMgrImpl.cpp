@@ -59,6 +59,8 @@ void updateMsgTimestamp(Message& msg, const DataInfo::Timestamp& timestamp)
     property::message::Timestamp().setTo(milliseconds.count(), msg);
 }
 
+const std::size_t MaxCachedFrames = 1024U;
+
 }  // namespace
 
 MsgMgrImpl::MsgMgrImpl()
@@ -83,6 +85,15 @@ void MsgMgrImpl::start()
         f->start();
     }
 
+    if (m_decodeProtocolCreateFunc) {
+        m_decodePool.reset(new DecodePool(m_decodeProtocolCreateFunc, 0U));
+        m_decodePool->setMsgDecodedCallbackFunc(
+            [this](MessagePtr msg, const DataInfo::Timestamp& timestamp)
+            {
+                msgDecoded(std::move(msg), timestamp);
+            });
+    }
+
     m_running = true;
 }
 
@@ -101,6 +112,11 @@ void MsgMgrImpl::stop()
         m_socket->stop();
     }
 
+    if (m_decodePool) {
+        m_droppedData += m_decodePool->droppedCount();
+        m_decodePool.reset();
+    }
+
     m_running = false;
 }
 
@@ -113,7 +129,10 @@ void MsgMgrImpl::clear()
 
     m_socket.reset();
     m_protocol.reset();
+    m_decodeProtocolCreateFunc = nullptr;
     m_filters.clear();
+    m_frameCache.clear();
+    m_droppedData = 0U;
 }
 
 SocketPtr MsgMgrImpl::getSocket() const
@@ -137,22 +156,14 @@ void MsgMgrImpl::deleteMsg(MessagePtr msg)
     assert(msg);
 
     auto msgNum = SeqNumber().getFrom(*msg);
-
-    auto iter = std::lower_bound(
-        m_allMsgs.begin(),
-        m_allMsgs.end(),
-        msgNum,
-        [](const MessagePtr& msgTmp, MsgNumberType val) -> bool
-        {
-            return SeqNumber().getFrom(*msgTmp) < val;
-        });
-
+    auto iter = findMsg(msgNum);
     if (iter == m_allMsgs.end()) {
         assert(!"Deleting non existing message.");
         return;
     }
 
     assert(msg.get() == iter->get()); // Make sure that the right message is found
+    m_index.remove(msgNum, *msg);
     m_allMsgs.erase(iter);
 }
 
@@ -175,35 +186,53 @@ void MsgMgrImpl::sendMsgs(MessagesList&& msgs)
                     property::message::Type().setTo(MsgType::Sent, *msgPtr);
                     auto now = DataInfo::TimestampClock::now();
                     updateMsgTimestamp(*msgPtr, now);
-                    m_allMsgs.push_back(msgPtr);
+                    storeMsg(msgPtr);
                     reportMsgAdded(msgPtr);
                 });
 
-        auto dataInfoPtr = m_protocol->write(*msgPtr);
-        if (!dataInfoPtr) {
-            continue;
+        // Repeated messages carry the key of their original, the frames
+        // are serialised and passed through the filters only once.
+        auto cacheKey = property::message::FrameCacheKey().getFrom(*msgPtr);
+        FramesList data;
+        auto cacheIter = m_frameCache.end();
+        if (cacheKey != 0U) {
+            cacheIter = m_frameCache.find(cacheKey);
         }
 
-        QList <DataInfoPtr> data;
-        data.append(std::move(dataInfoPtr));
-        for (auto& filter : m_filters) {
-            if (data.isEmpty()) {
-                break;
-            }
-
-            QList <DataInfoPtr> dataTmp;
-            for (auto& d : data) {
-                dataTmp.append(filter->sendData(d));
+        bool cacheHit = (cacheIter != m_frameCache.end());
+        bool shared = cacheHit;
+        if (cacheHit) {
+            data = cacheIter->second;
+        }
+        else {
+            data = serialiseMsg(*msgPtr);
+            if ((cacheKey != 0U) && (!data.isEmpty())) {
+                while (MaxCachedFrames <= m_frameCache.size()) {
+                    // Keys are allocated incrementally, drop the oldest
+                    m_frameCache.erase(m_frameCache.begin());
+                }
+                m_frameCache.insert(std::make_pair(cacheKey, data));
+                shared = true;
             }
-
-            data.swap(dataTmp);
         }
 
         if (data.isEmpty()) {
             continue;
         }
 
-        for (auto& d : data) {
+        for (auto& frame : data) {
+            auto d = frame;
+            if (shared) {
+                // Cached frames must stay intact, the sockets and the patch
+                // function record their properties in a fresh copy.
+                d = makeDataInfo();
+                *d = *frame;
+            }
+
+            if (m_sendFramePatchFunc) {
+                m_sendFramePatchFunc(*msgPtr, *d);
+            }
+
             m_socket->sendData(d);
 
             if (!d->m_extraProperties.isEmpty()) {
@@ -212,7 +241,12 @@ void MsgMgrImpl::sendMsgs(MessagesList&& msgs)
                     map.insert(key, d->m_extraProperties.value(key));
                 }
                 property::message::ExtraInfo().setTo(std::move(map), *msgPtr);
-                m_protocol->updateMessage(*msgPtr);
+
+                // The frame of the repeated message hasn't changed,
+                // no need to update the message from it again.
+                if (!cacheHit) {
+                    m_protocol->updateMessage(*msgPtr);
+                }
             }
         }
     }
@@ -242,10 +276,100 @@ void MsgMgrImpl::addMsgs(const MessagesList& msgs, bool reportAdded)
         if (reportAdded) {
             reportMsgAdded(m);
         }
-        m_allMsgs.push_back(m);
+        storeMsg(m);
     }
 }
 
+MsgMgrImpl::AllMessages MsgMgrImpl::findMsgs(const MsgsQuery& query)
+{
+    AllMessages result;
+    auto* postings = m_index.idPostings(query.m_id);
+    if (postings == nullptr) {
+        return result;
+    }
+
+    if (0 <= query.m_fieldIdx) {
+        if (!m_index.hasFieldIndex(query.m_id, query.m_fieldIdx)) {
+            m_index.addFieldIndex(
+                query.m_id,
+                query.m_fieldIdx,
+                [this](MsgNumberType msgNum) -> Message*
+                {
+                    auto iter = findMsg(msgNum);
+                    if (iter == m_allMsgs.end()) {
+                        return nullptr;
+                    }
+                    return iter->get();
+                });
+        }
+
+        postings = m_index.fieldPostings(query.m_id, query.m_fieldIdx, query.m_fieldValue);
+        if (postings == nullptr) {
+            return result;
+        }
+    }
+
+    result.reserve(postings->size());
+    auto searchFrom = m_allMsgs.cbegin();
+    for (auto msgNum : *postings) {
+        auto iter = std::lower_bound(
+            searchFrom,
+            m_allMsgs.cend(),
+            msgNum,
+            [](const MessagePtr& msgTmp, MsgNumberType val) -> bool
+            {
+                return SeqNumber().getFrom(*msgTmp) < val;
+            });
+
+        if (iter == m_allMsgs.cend()) {
+            break;
+        }
+
+        searchFrom = iter;
+        if (SeqNumber().getFrom(**iter) == msgNum) {
+            result.push_back(*iter);
+        }
+    }
+    return result;
+}
+
+bool MsgMgrImpl::msgMatches(Message& msg, const MsgsQuery& query)
+{
+    if (msg.idAsString() != query.m_id) {
+        return false;
+    }
+
+    if (query.m_fieldIdx < 0) {
+        return true;
+    }
+
+    return MsgIndex::fieldValue(msg, query.m_fieldIdx) == query.m_fieldValue;
+}
+
+MsgMgrImpl::FramesList MsgMgrImpl::serialiseMsg(Message& msg)
+{
+    FramesList data;
+    auto dataInfoPtr = m_protocol->write(msg);
+    if (!dataInfoPtr) {
+        return data;
+    }
+
+    data.append(std::move(dataInfoPtr));
+    for (auto& filter : m_filters) {
+        if (data.isEmpty()) {
+            break;
+        }
+
+        FramesList dataTmp;
+        for (auto& d : data) {
+            dataTmp.append(filter->sendData(d));
+        }
+
+        data.swap(dataTmp);
+    }
+    return data;
+}
+
 void MsgMgrImpl::setSocket(SocketPtr socket)
 {
     if (!socket) {
@@ -272,11 +396,38 @@ void MsgMgrImpl::setSocket(SocketPtr socket)
         });
 
     m_socket = std::move(socket);
+    m_frameCache.clear();
 }
 
 void MsgMgrImpl::setProtocol(ProtocolPtr protocol)
 {
     m_protocol = std::move(protocol);
+    m_frameCache.clear();
+}
+
+void MsgMgrImpl::setDecodeProtocolCreateFunc(ProtocolCreateFunc&& func)
+{
+    assert(!m_running);
+    m_decodeProtocolCreateFunc = std::move(func);
+}
+
+void MsgMgrImpl::resetLatencyStats()
+{
+    for (auto& hist : m_latencyStats) {
+        hist.reset();
+    }
+}
+
+MsgMgrImpl::DecodeStats MsgMgrImpl::getDecodeStats() const
+{
+    DecodeStats stats;
+    stats.m_droppedData = m_droppedData;
+    if (m_decodePool) {
+        stats.m_droppedData += m_decodePool->droppedCount();
+        stats.m_queued = m_decodePool->queuedCount();
+        stats.m_threaded = true;
+    }
+    return stats;
 }
 
 void MsgMgrImpl::addFilter(FilterPtr filter)
@@ -330,6 +481,7 @@ void MsgMgrImpl::addFilter(FilterPtr filter)
         });
 
     m_filters.push_back(std::move(filter));
+    m_frameCache.clear();
 }
 
 void MsgMgrImpl::socketDataReceived(DataInfoPtr dataInfoPtr)
@@ -338,6 +490,7 @@ void MsgMgrImpl::socketDataReceived(DataInfoPtr dataInfoPtr)
         return;
     }
 
+    auto timestamp = dataInfoPtr->m_timestamp;
     QList<DataInfoPtr> data;
     data.append(std::move(dataInfoPtr));
     for (auto filt : m_filters) {
@@ -359,6 +512,17 @@ void MsgMgrImpl::socketDataReceived(DataInfoPtr dataInfoPtr)
         return;
     }
 
+    if (m_latencyStatsEnabled) {
+        recordLatency(MsgMgr::LatencyStage_Filtered, timestamp, DataInfo::TimestampClock::now());
+    }
+
+    if (m_decodePool) {
+        for (auto& d : data) {
+            m_decodePool->pushData(std::move(d));
+        }
+        return;
+    }
+
     MessagesList msgsList;
     while (!data.isEmpty()) {
         auto nextDataPtr = data.front();
@@ -372,25 +536,82 @@ void MsgMgrImpl::socketDataReceived(DataInfoPtr dataInfoPtr)
         return;
     }
 
+    if (m_latencyStatsEnabled) {
+        auto now = DataInfo::TimestampClock::now();
+        for (std::size_t idx = 0U; idx < msgsList.size(); ++idx) {
+            recordLatency(MsgMgr::LatencyStage_Decoded, timestamp, now);
+        }
+    }
+
     for (auto& m : msgsList) {
         assert(m);
-        updateInternalId(*m);
-        property::message::Type().setTo(MsgType::Received, *m);
+        reportReceivedMsg(m, timestamp);
+    }
 
-        static const DataInfo::Timestamp DefaultTimestamp;
-        if (dataInfoPtr->m_timestamp != DefaultTimestamp) {
-            updateMsgTimestamp(*m, dataInfoPtr->m_timestamp);
-        }
-        else {
-            auto now = DataInfo::TimestampClock::now();
-            updateMsgTimestamp(*m, now);
-        }
+    m_allMsgs.reserve(m_allMsgs.size() + msgsList.size());
+    for (auto& m : msgsList) {
+        storeMsg(std::move(m));
+    }
+}
 
-        reportMsgAdded(m);
+void MsgMgrImpl::msgDecoded(MessagePtr msg, const DataInfo::Timestamp& timestamp)
+{
+    assert(msg);
+    if (!m_recvEnabled) {
+        return;
     }
 
-    m_allMsgs.reserve(m_allMsgs.size() + msgsList.size());
-    std::move(msgsList.begin(), msgsList.end(), std::back_inserter(m_allMsgs));
+    if (m_latencyStatsEnabled) {
+        recordLatency(MsgMgr::LatencyStage_Decoded, timestamp, DataInfo::TimestampClock::now());
+    }
+
+    reportReceivedMsg(msg, timestamp);
+    storeMsg(std::move(msg));
+}
+
+void MsgMgrImpl::reportReceivedMsg(
+    const MessagePtr& msg,
+    const DataInfo::Timestamp& timestamp)
+{
+    updateInternalId(*msg);
+    property::message::Type().setTo(MsgType::Received, *msg);
+
+    static const DataInfo::Timestamp DefaultTimestamp;
+    if (timestamp != DefaultTimestamp) {
+        updateMsgTimestamp(*msg, timestamp);
+    }
+    else {
+        auto now = DataInfo::TimestampClock::now();
+        updateMsgTimestamp(*msg, now);
+    }
+
+    if (!m_latencyStatsEnabled) {
+        reportMsgAdded(msg);
+        return;
+    }
+
+    auto reportStart = DataInfo::TimestampClock::now();
+    reportMsgAdded(msg);
+    auto reportEnd = DataInfo::TimestampClock::now();
+    recordLatency(MsgMgr::LatencyStage_Callback, reportStart, reportEnd);
+    recordLatency(MsgMgr::LatencyStage_Reported, timestamp, reportEnd);
+}
+
+void MsgMgrImpl::recordLatency(
+    LatencyStage stage,
+    const DataInfo::Timestamp& from,
+    const DataInfo::Timestamp& to)
+{
+    static const DataInfo::Timestamp DefaultTimestamp;
+    if (from == DefaultTimestamp) {
+        // Socket doesn't timestamp its data
+        return;
+    }
+
+    assert(stage < m_latencyStats.size());
+    auto diff = std::chrono::duration_cast<std::chrono::microseconds>(to - from).count();
+    m_latencyStats[stage].record(
+        static_cast<LatencyHistogram::ValueType>(std::max(diff, decltype(diff)(0))));
 }
 
 void MsgMgrImpl::updateInternalId(Message& msg)
@@ -400,6 +621,35 @@ void MsgMgrImpl::updateInternalId(Message& msg)
     assert(0 < m_nextMsgNum); // wrap around is not supported
 }
 
+void MsgMgrImpl::storeMsg(MessagePtr msg)
+{
+    assert(msg);
+    if (!m_storeMsgsEnabled) {
+        return;
+    }
+
+    m_index.add(SeqNumber().getFrom(*msg), *msg);
+    m_allMsgs.push_back(std::move(msg));
+}
+
+MsgMgrImpl::AllMessages::const_iterator MsgMgrImpl::findMsg(MsgNumberType msgNum) const
+{
+    auto iter = std::lower_bound(
+        m_allMsgs.begin(),
+        m_allMsgs.end(),
+        msgNum,
+        [](const MessagePtr& msgTmp, MsgNumberType val) -> bool
+        {
+            return SeqNumber().getFrom(*msgTmp) < val;
+        });
+
+    if ((iter != m_allMsgs.end()) && (SeqNumber().getFrom(**iter) != msgNum)) {
+        return m_allMsgs.end();
+    }
+
+    return iter;
+}
+
 void MsgMgrImpl::reportMsgAdded(MessagePtr msg)
 {
     if (m_msgAddedCallback) {
@@ -19,8 +19,12 @@
 #pragma once
 
 #include <vector>
+#include <memory>
+#include <map>
 
 #include "comms_champion/MsgMgr.h"
+#include "DecodePool.h"
+#include "MsgIndex.h"
 
 namespace comms_champion
 {
@@ -32,6 +36,12 @@ public:
     typedef MsgMgr::MessagesList MessagesList;
 
     typedef MsgMgr::MsgType MsgType;
+    typedef MsgMgr::DecodeStats DecodeStats;
+    typedef MsgMgr::ProtocolCreateFunc ProtocolCreateFunc;
+    typedef MsgMgr::MsgsQuery MsgsQuery;
+    typedef MsgMgr::SendFramePatchFunc SendFramePatchFunc;
+    typedef MsgMgr::LatencyStage LatencyStage;
+    typedef MsgMgr::LatencyStats LatencyStats;
 
     MsgMgrImpl();
     ~MsgMgrImpl();
@@ -44,23 +54,56 @@ public:
     ProtocolPtr getProtocol() const;
     void setRecvEnabled(bool enabled);
 
+    void setStoreMsgsEnabled(bool enabled)
+    {
+        m_storeMsgsEnabled = enabled;
+    }
+
     void deleteMsg(MessagePtr msg);
     void deleteAllMsgs()
     {
         m_allMsgs.clear();
+        m_index.clear();
     }
 
     void sendMsgs(MessagesList&& msgs);
 
+    template <typename TFunc>
+    void setSendFramePatchFunc(TFunc&& func)
+    {
+        m_sendFramePatchFunc = std::forward<TFunc>(func);
+    }
+
+    void clearFrameCache()
+    {
+        m_frameCache.clear();
+    }
+
     const AllMessages& getAllMsgs() const
     {
         return m_allMsgs;
     }
 
     void addMsgs(const MessagesList& msgs, bool reportAdded);
+    AllMessages findMsgs(const MsgsQuery& query);
+    static bool msgMatches(Message& msg, const MsgsQuery& query);
 
     void setSocket(SocketPtr socket);
     void setProtocol(ProtocolPtr protocol);
+    void setDecodeProtocolCreateFunc(ProtocolCreateFunc&& func);
+    DecodeStats getDecodeStats() const;
+
+    void setLatencyStatsEnabled(bool enabled)
+    {
+        m_latencyStatsEnabled = enabled;
+    }
+
+    const LatencyStats& getLatencyStats() const
+    {
+        return m_latencyStats;
+    }
+
+    void resetLatencyStats();
     void addFilter(FilterPtr filter);
 
     typedef MsgMgr::MsgAddedCallbackFunc MsgAddedCallbackFunc;
@@ -88,20 +131,40 @@ public:
 private:
     typedef unsigned long long MsgNumberType;
     typedef std::vector<FilterPtr> FiltersList;
+    typedef QList<DataInfoPtr> FramesList;
+    typedef std::map<unsigned long long, FramesList> FrameCache;
 
     void socketDataReceived(DataInfoPtr dataInfoPtr);
+    void msgDecoded(MessagePtr msg, const DataInfo::Timestamp& timestamp);
+    void reportReceivedMsg(const MessagePtr& msg, const DataInfo::Timestamp& timestamp);
+    void recordLatency(
+        LatencyStage stage,
+        const DataInfo::Timestamp& from,
+        const DataInfo::Timestamp& to);
+    FramesList serialiseMsg(Message& msg);
     void updateInternalId(Message& msg);
+    void storeMsg(MessagePtr msg);
+    AllMessages::const_iterator findMsg(MsgNumberType msgNum) const;
     void reportMsgAdded(MessagePtr msg);
     void reportError(const QString& error);
     void reportSocketDisconnected();
 
     AllMessages m_allMsgs;
+    MsgIndex m_index;
     bool m_recvEnabled = false;
+    bool m_storeMsgsEnabled = true;
+    bool m_latencyStatsEnabled = false;
+    LatencyStats m_latencyStats;
 
     SocketPtr m_socket;
     ProtocolPtr m_protocol;
+    ProtocolCreateFunc m_decodeProtocolCreateFunc;
+    std::unique_ptr<DecodePool> m_decodePool;
+    unsigned long long m_droppedData = 0U;
     FiltersList m_filters;
     MsgNumberType m_nextMsgNum = 1;
+    FrameCache m_frameCache;
+    SendFramePatchFunc m_sendFramePatchFunc;
     bool m_running = false;
 
     MsgAddedCallbackFunc m_msgAddedCallback;
@@ -18,130 +18,201 @@
 #include "MsgSendMgrImpl.h"
 
 #include <cassert>
+#include <algorithm>
 
 #include "comms_champion/property/message.h"
+#include "comms_champion/MsgMgr.h"
 
 namespace comms_champion
 {
 
+namespace
+{
+
+// When the sending falls behind more than this, the periodic messages
+// are rescheduled relative to the current time instead of sending
+// all the missed ones in a burst.
+const MsgSendWheel::Clock::duration MaxLag = std::chrono::milliseconds(100);
+
+}  // namespace
+
 MsgSendMgrImpl::MsgSendMgrImpl()
-  : m_timer(this)
+  : m_timingThread(&MsgSendMgrImpl::timingThreadFunc, this)
 {
-    connect(
-        &m_timer, SIGNAL(timeout()),
-        this, SLOT(sendPendingAndWait()));
 }
 
-MsgSendMgrImpl::~MsgSendMgrImpl() = default;
+MsgSendMgrImpl::~MsgSendMgrImpl()
+{
+    {
+        std::lock_guard<std::mutex> guard(m_timingMutex);
+        m_timingStopRequested = true;
+    }
+    m_timingCond.notify_one();
+    m_timingThread.join();
+}
 
 void MsgSendMgrImpl::start(ProtocolPtr protocol, const MessagesList& msgs)
 {
-    assert(m_msgsToSend.empty() || !"The previous sending must be stopped first.");
+    assert(m_wheel.empty() || !"The previous sending must be stopped first.");
     m_protocol = std::move(protocol);
+    m_scheduled.clear();
+    m_scheduled.reserve(msgs.size());
+
+    auto deadline = Clock::now();
+    m_wheel.reset(deadline);
     for (auto& m : msgs) {
         auto clonedMsg = m_protocol->cloneMessage(*m);
+        if (!clonedMsg) {
+            assert(!"Failed to clone message");
+            continue;
+        }
+
         property::message::Delay().copyFromTo(*m, *clonedMsg);
         property::message::DelayUnits().copyFromTo(*m, *clonedMsg);
         property::message::RepeatDuration().copyFromTo(*m, *clonedMsg);
         property::message::RepeatDurationUnits().copyFromTo(*m, *clonedMsg);
         property::message::RepeatCount().copyFromTo(*m, *clonedMsg);
 
+        // The key stays with the original message until it's edited,
+        // so its serialised frames can be reused by MsgMgr.
+        auto cacheKey = property::message::FrameCacheKey().getFrom(*m);
+        if (cacheKey == 0U) {
+            cacheKey = MsgMgr::allocFrameCacheKey();
+            property::message::FrameCacheKey().setTo(cacheKey, *m);
+        }
+        property::message::FrameCacheKey().setTo(cacheKey, *clonedMsg);
+
+        // The delay is relative to the previous message in the list
+        deadline += std::chrono::milliseconds(property::message::Delay().getFrom(*m));
+
+        ScheduledMsg info;
+        info.m_msg = std::move(clonedMsg);
+        info.m_repeat =
+            std::chrono::milliseconds(property::message::RepeatDuration().getFrom(*m));
+        info.m_remaining = property::message::RepeatCount().getFrom(*m);
+
         // TODO: copy custom properties
-        m_msgsToSend.push_back(std::move(clonedMsg));
+        m_wheel.schedule(m_scheduled.size(), deadline);
+        m_scheduled.push_back(std::move(info));
     }
     sendPendingAndWait();
 }
 
 void MsgSendMgrImpl::stop()
 {
-    m_timer.stop();
+    cancelNextCheck();
     m_protocol.reset();
-    m_msgsToSend.clear();
+    m_scheduled.clear();
+    m_wheel.reset(Clock::now());
 }
 
 void MsgSendMgrImpl::sendPendingAndWait()
 {
-    m_timer.stop();
-    auto iter = m_msgsToSend.begin();
-    for (; iter != m_msgsToSend.end(); ++iter) {
-        auto& msg = *iter;
-        assert(msg);
-        auto delay = property::message::Delay().getFrom(*msg);
-        if (delay != 0U) {
-            break;
-        }
+    if (!m_protocol) {
+        // Wake up requested before stop or completion
+        return;
     }
 
-    decltype(m_msgsToSend) nextMsgsToSend;
-    nextMsgsToSend.splice(
-        nextMsgsToSend.end(), m_msgsToSend, m_msgsToSend.begin(), iter);
-
-    for (auto& msgToSend : nextMsgsToSend) {
-        auto repeatMs = property::message::RepeatDuration().getFrom(*msgToSend);
-        auto repeatCount = property::message::RepeatCount().getFrom(*msgToSend);
-
-        bool reinsert =
-            (0U < repeatMs) &&
-            ((repeatCount == 0U) || (1U < repeatCount));
-
-        if (reinsert) {
-            if (!m_protocol) {
-                assert(!"Expecting protocol to be valid");
-                continue;
-            }
-
-            auto newDelay = repeatMs;
-            auto reinsertIter =
-                std::find_if(
-                    m_msgsToSend.begin(), m_msgsToSend.end(),
-                    [&newDelay](MessagePtr mPtr) mutable -> bool
-                    {
-                        assert(mPtr);
-                        auto mDelay = property::message::Delay().getFrom(*mPtr);
-                        if (newDelay < mDelay) {
-                            return true;
-                        }
-                        newDelay -= mDelay;
-                        return false;
-                    });
-
-            if (reinsertIter != m_msgsToSend.end()) {
-                auto& msgToUpdate = *reinsertIter;
-                assert(msgToUpdate);
-                auto mDelay = property::message::Delay().getFrom(*msgToUpdate);
-                property::message::Delay().setTo(mDelay - newDelay, *msgToUpdate);
-            }
-
-            auto clonedMsg = m_protocol->cloneMessage(*msgToSend);
-            // TODO copy extra properties
-
-            std::swap(clonedMsg, msgToSend);
-            property::message::Delay().setTo(newDelay, *clonedMsg);
-
-            if (repeatCount != 0) {
-                property::message::RepeatCount().setTo(repeatCount - 1, *clonedMsg);
-            }
-
-            m_msgsToSend.insert(reinsertIter, std::move(clonedMsg));
+    auto now = Clock::now();
+    m_expired.clear();
+    m_wheel.expire(now, m_expired);
+
+    MessagesList nextMsgsToSend;
+    for (auto& expired : m_expired) {
+        assert(expired.m_idx < m_scheduled.size());
+        auto& info = m_scheduled[expired.m_idx];
+        assert(info.m_msg);
+
+        bool reschedule =
+            (Duration::zero() < info.m_repeat) &&
+            ((info.m_remaining == 0U) || (1U < info.m_remaining));
+
+        if (!reschedule) {
+            // Last send, no need to keep the original
+            nextMsgsToSend.push_back(std::move(info.m_msg));
+            continue;
+        }
+
+        if (!m_protocol) {
+            assert(!"Expecting protocol to be valid");
+            continue;
+        }
+
+        auto clonedMsg = m_protocol->cloneMessage(*info.m_msg);
+        if (clonedMsg) {
+            property::message::FrameCacheKey().copyFromTo(*info.m_msg, *clonedMsg);
+            nextMsgsToSend.push_back(std::move(clonedMsg));
         }
+
+        if (info.m_remaining != 0U) {
+            --info.m_remaining;
+        }
+
+        // Next deadline is calculated from the previous one rather than
+        // from current time to avoid accumulating drift.
+        auto nextDeadline = expired.m_deadline + info.m_repeat;
+        if (nextDeadline < (now - MaxLag)) {
+            nextDeadline = now;
+        }
+        m_wheel.schedule(expired.m_idx, nextDeadline);
     }
 
-    if (!m_msgsToSend.empty()) {
-        auto& msg = m_msgsToSend.front();
-        assert(msg);
-        auto delay = property::message::Delay().getFrom(*msg);
-        assert(0 < delay);
-        property::message::Delay().setTo(0, *msg);
-        m_timer.setSingleShot(true);
-        m_timer.start(static_cast<int>(delay));
+    bool complete = m_wheel.empty();
+    if (complete) {
+        cancelNextCheck();
+        m_protocol.reset();
+    }
+    else {
+        scheduleNextCheck();
     }
 
     if ((!nextMsgsToSend.empty()) && m_sendCallback) {
         m_sendCallback(std::move(nextMsgsToSend));
     }
 
-    if (m_msgsToSend.empty() && m_sendCompleteCallback) {
+    if (complete && m_sendCompleteCallback) {
         m_sendCompleteCallback();
     }
 }
+
+void MsgSendMgrImpl::scheduleNextCheck()
+{
+    {
+        std::lock_guard<std::mutex> guard(m_timingMutex);
+        m_nextCheck = m_wheel.nextCheck();
+    }
+    m_timingCond.notify_one();
+}
+
+void MsgSendMgrImpl::cancelNextCheck()
+{
+    std::lock_guard<std::mutex> guard(m_timingMutex);
+    m_nextCheck = TimePoint::max();
+}
+
+void MsgSendMgrImpl::timingThreadFunc()
+{
+    std::unique_lock<std::mutex> lock(m_timingMutex);
+    while (!m_timingStopRequested) {
+        if (m_nextCheck == TimePoint::max()) {
+            m_timingCond.wait(lock);
+            continue;
+        }
+
+        // The waiting is performed with high resolution timer, unlike
+        // QTimer, which has millisecond granularity. The check time is
+        // re-evaluated after every wake up, it may have been updated.
+        auto nextCheck = m_nextCheck;
+        if (Clock::now() < nextCheck) {
+            m_timingCond.wait_until(lock, nextCheck);
+            continue;
+        }
+
+        m_nextCheck = TimePoint::max();
+        lock.unlock();
+        QMetaObject::invokeMethod(this, "sendPendingAndWait", Qt::QueuedConnection);
+        lock.lock();
+    }
+}
+
 }  // namespace comms_champion
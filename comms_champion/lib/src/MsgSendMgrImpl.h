@@ -18,16 +18,21 @@
 #pragma once
 
 #include <memory>
+#include <vector>
+#include <chrono>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
 
 #include "comms/CompileControl.h"
 
 CC_DISABLE_WARNINGS()
 #include <QtCore/QObject>
-#include <QtCore/QTimer>
 CC_ENABLE_WARNINGS()
 
 #include "comms_champion/MsgSendMgr.h"
 #include "comms_champion/Protocol.h"
+#include "MsgSendWheel.h"
 
 namespace comms_champion
 {
@@ -63,11 +68,35 @@ private slots:
     void sendPendingAndWait();
 
 private:
+    typedef MsgSendWheel::Clock Clock;
+    typedef MsgSendWheel::TimePoint TimePoint;
+    typedef MsgSendWheel::Duration Duration;
+
+    struct ScheduledMsg
+    {
+        MessagePtr m_msg;
+        Duration m_repeat = Duration::zero();
+        unsigned m_remaining = 0U; // 0 means infinite
+    };
+
+    void scheduleNextCheck();
+    void cancelNextCheck();
+    void timingThreadFunc();
+
     SendMsgsCallbackFunc m_sendCallback;
     SendCompleteCallbackFunc m_sendCompleteCallback;
     ProtocolPtr m_protocol;
-    MessagesList m_msgsToSend;
-    QTimer m_timer;
+    std::vector<ScheduledMsg> m_scheduled;
+    MsgSendWheel m_wheel;
+    MsgSendWheel::ExpiredList m_expired;
+
+    // The deadlines are tracked by a dedicated thread, which wakes up the
+    // owner thread when the next check is due.
+    std::mutex m_timingMutex;
+    std::condition_variable m_timingCond;
+    TimePoint m_nextCheck = TimePoint::max();
+    bool m_timingStopRequested = false;
+    std::thread m_timingThread;
 };
 
 }  // namespace comms_champion
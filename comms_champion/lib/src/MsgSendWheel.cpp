@@ -0,0 +1,294 @@
+//
+// Copyright 2017 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#include "MsgSendWheel.h"
+
+#include <algorithm>
+#include <iterator>
+#include <cassert>
+
+namespace comms_champion
+{
+
+const MsgSendWheel::Duration MsgSendWheel::Tick(100);
+
+MsgSendWheel::MsgSendWheel()
+{
+    reset(Clock::now());
+}
+
+MsgSendWheel::~MsgSendWheel() = default;
+
+void MsgSendWheel::reset(TimePoint start)
+{
+    for (auto& level : m_levels) {
+        for (auto& slot : level.m_slots) {
+            slot.clear();
+        }
+        level.m_count = 0U;
+    }
+
+    m_overflow.clear();
+    m_start = start;
+    m_current = 0U;
+    m_nextSeq = 0U;
+}
+
+void MsgSendWheel::schedule(std::size_t idx, TimePoint deadline)
+{
+    Entry entry;
+    entry.m_idx = idx;
+    entry.m_seq = m_nextSeq;
+    entry.m_deadline = deadline;
+    ++m_nextSeq;
+    insert(std::move(entry));
+}
+
+void MsgSendWheel::expire(TimePoint now, ExpiredList& expired)
+{
+    auto target = toTick(now);
+    m_due.clear();
+    while (m_current < target) {
+        auto& level0 = m_levels[0];
+        takeSlot(level0.m_slots[m_current & SlotMask], TimePoint::max(), m_due, level0.m_count);
+
+        // Jump over the ticks that cannot have any entries
+        std::uint64_t granularity = 1U;
+        unsigned emptyLevels = 0U;
+        for (auto& level : m_levels) {
+            if (level.m_count != 0U) {
+                break;
+            }
+            ++emptyLevels;
+            granularity <<= SlotBits;
+        }
+
+        if (emptyLevels == LevelsCount) {
+            if (m_overflow.empty()) {
+                m_current = target;
+                break;
+            }
+
+            // Only the top level boundaries need to be visited
+            granularity = std::uint64_t(1U) << TopShift;
+        }
+
+        auto next = ((m_current / granularity) + 1U) * granularity;
+        if (target < next) {
+            m_current = target;
+            break;
+        }
+
+        m_current = next;
+        cascade();
+    }
+
+    auto& level0 = m_levels[0];
+    takeSlot(level0.m_slots[m_current & SlotMask], now, m_due, level0.m_count);
+
+    std::sort(
+        m_due.begin(), m_due.end(),
+        [](const Entry& e1, const Entry& e2) -> bool
+        {
+            if (e1.m_deadline != e2.m_deadline) {
+                return e1.m_deadline < e2.m_deadline;
+            }
+            return e1.m_seq < e2.m_seq;
+        });
+
+    expired.reserve(expired.size() + m_due.size());
+    for (auto& e : m_due) {
+        Expired info;
+        info.m_idx = e.m_idx;
+        info.m_deadline = e.m_deadline;
+        expired.push_back(info);
+    }
+    m_due.clear();
+}
+
+MsgSendWheel::TimePoint MsgSendWheel::nextCheck() const
+{
+    assert(!empty());
+    auto result = TimePoint::max();
+    auto& level0 = m_levels[0];
+    if (level0.m_count != 0U) {
+        std::uint64_t offset = 0U;
+        for (; offset < SlotsCount; ++offset) {
+            auto& slot = level0.m_slots[(m_current + offset) & SlotMask];
+            if (slot.empty()) {
+                continue;
+            }
+
+            auto iter =
+                std::min_element(
+                    slot.begin(), slot.end(),
+                    [](const Entry& e1, const Entry& e2) -> bool
+                    {
+                        return e1.m_deadline < e2.m_deadline;
+                    });
+            result = iter->m_deadline;
+            break;
+        }
+
+        assert((offset < SlotsCount) || (!"Level count is out of sync"));
+    }
+
+    // The entries of the higher levels may have earlier deadlines than
+    // the ones in the lowest level, the wheel needs to be checked when
+    // they are cascaded.
+    for (unsigned levelIdx = 1U; levelIdx < LevelsCount; ++levelIdx) {
+        auto& level = m_levels[levelIdx];
+        if (level.m_count == 0U) {
+            continue;
+        }
+
+        auto shift = levelIdx * SlotBits;
+        auto base = m_current >> shift;
+        std::uint64_t offset = 1U;
+        for (; offset <= SlotsCount; ++offset) {
+            if (!level.m_slots[(base + offset) & SlotMask].empty()) {
+                result = std::min(result, fromTick((base + offset) << shift));
+                break;
+            }
+        }
+
+        assert((offset <= SlotsCount) || (!"Level count is out of sync"));
+    }
+
+    if (!m_overflow.empty()) {
+        auto nextBoundary = ((m_current >> TopShift) + 1U) << TopShift;
+        result = std::min(result, fromTick(nextBoundary));
+    }
+
+    return result;
+}
+
+bool MsgSendWheel::empty() const
+{
+    return
+        std::all_of(
+            m_levels.begin(), m_levels.end(),
+            [](const LevelInfo& level) -> bool
+            {
+                return level.m_count == 0U;
+            }) &&
+        m_overflow.empty();
+}
+
+std::uint64_t MsgSendWheel::toTick(TimePoint time) const
+{
+    if (time <= m_start) {
+        return 0U;
+    }
+
+    auto diff = std::chrono::duration_cast<Duration>(time - m_start);
+    return static_cast<std::uint64_t>(diff.count() / Tick.count());
+}
+
+MsgSendWheel::TimePoint MsgSendWheel::fromTick(std::uint64_t tick) const
+{
+    return m_start + Tick * static_cast<Duration::rep>(tick);
+}
+
+void MsgSendWheel::insert(Entry&& entry)
+{
+    static const std::uint64_t MaxDelta =
+        (std::uint64_t(1U) << (SlotBits * LevelsCount)) - 1U;
+
+    auto tick = std::max(toTick(entry.m_deadline), m_current);
+    auto delta = tick - m_current;
+    if (MaxDelta < delta) {
+        m_overflow.push_back(std::move(entry));
+        return;
+    }
+
+    unsigned levelIdx = 0U;
+    while ((levelIdx < (LevelsCount - 1U)) &&
+           ((std::uint64_t(1U) << (SlotBits * (levelIdx + 1U))) <= delta)) {
+        ++levelIdx;
+    }
+
+    auto& level = m_levels[levelIdx];
+    auto slotIdx = (tick >> (levelIdx * SlotBits)) & SlotMask;
+    level.m_slots[slotIdx].push_back(std::move(entry));
+    ++level.m_count;
+}
+
+void MsgSendWheel::cascade()
+{
+    if ((m_current & ((std::uint64_t(1U) << TopShift) - 1U)) == 0U) {
+        cascadeOverflow();
+    }
+
+    std::vector<Entry> entries;
+    for (auto levelIdx = LevelsCount - 1U; 0U < levelIdx; --levelIdx) {
+        auto shift = levelIdx * SlotBits;
+        auto boundaryMask = (std::uint64_t(1U) << shift) - 1U;
+        if ((m_current & boundaryMask) != 0U) {
+            continue;
+        }
+
+        auto& level = m_levels[levelIdx];
+        if (level.m_count == 0U) {
+            continue;
+        }
+
+        entries.clear();
+        takeSlot(level.m_slots[(m_current >> shift) & SlotMask], TimePoint::max(), entries, level.m_count);
+        for (auto& e : entries) {
+            insert(std::move(e));
+        }
+    }
+}
+
+void MsgSendWheel::cascadeOverflow()
+{
+    if (m_overflow.empty()) {
+        return;
+    }
+
+    std::vector<Entry> entries;
+    entries.swap(m_overflow);
+    for (auto& e : entries) {
+        insert(std::move(e));
+    }
+}
+
+void MsgSendWheel::takeSlot(
+    Slot& slot,
+    TimePoint now,
+    std::vector<Entry>& due,
+    std::size_t& count)
+{
+    auto iter =
+        std::stable_partition(
+            slot.begin(), slot.end(),
+            [now](const Entry& e) -> bool
+            {
+                return now < e.m_deadline;
+            });
+
+    auto dueCount = static_cast<std::size_t>(std::distance(iter, slot.end()));
+    assert(dueCount <= count);
+    std::move(iter, slot.end(), std::back_inserter(due));
+    slot.erase(iter, slot.end());
+    count -= dueCount;
+}
+
+}  // namespace comms_champion
+
@@ -0,0 +1,121 @@
+//
+// Copyright 2017 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <array>
+#include <vector>
+#include <chrono>
+
+namespace comms_champion
+{
+
+/// @brief Hierarchical timing wheel used to schedule messages to send.
+/// @details Every scheduled entry is identified by the index provided
+///     by the caller and has an absolute deadline with microseconds
+///     precision. Scheduling an entry is O(1), and entries are
+///     cascaded into lower levels of the wheel when their time
+///     approaches.
+class MsgSendWheel
+{
+public:
+    typedef std::chrono::steady_clock Clock;
+    typedef Clock::time_point TimePoint;
+    typedef std::chrono::microseconds Duration;
+
+    /// @brief Expired entry
+    struct Expired
+    {
+        std::size_t m_idx = 0U;
+        TimePoint m_deadline;
+    };
+
+    typedef std::vector<Expired> ExpiredList;
+
+    /// @brief Granularity of the lowest level.
+    static const Duration Tick;
+
+    MsgSendWheel();
+    ~MsgSendWheel();
+
+    /// @brief Remove all the entries and restart counting ticks from
+    ///     provided time point.
+    void reset(TimePoint start);
+
+    /// @brief Schedule an entry.
+    void schedule(std::size_t idx, TimePoint deadline);
+
+    /// @brief Collect all the entries with deadline not later than
+    ///     @b now.
+    /// @details The entries are appended in order of their deadlines,
+    ///     the ones with the same deadline are appended in order of
+    ///     their scheduling.
+    void expire(TimePoint now, ExpiredList& expired);
+
+    /// @brief Earliest time the wheel needs to be checked again.
+    /// @details The returned value is never later than the earliest
+    ///     deadline, but may be earlier when entries need to be cascaded
+    ///     from the higher levels.
+    ///     Mustn't be invoked on empty wheel.
+    TimePoint nextCheck() const;
+
+    /// @brief Check whether there are no scheduled entries
+    bool empty() const;
+
+private:
+    static const unsigned SlotBits = 8U;
+    static const std::size_t SlotsCount = 1U << SlotBits;
+    static const std::uint64_t SlotMask = SlotsCount - 1U;
+    static const unsigned LevelsCount = 4U;
+    static const unsigned TopShift = SlotBits * (LevelsCount - 1U);
+
+    struct Entry
+    {
+        std::size_t m_idx = 0U;
+        std::uint64_t m_seq = 0U;
+        TimePoint m_deadline;
+    };
+
+    typedef std::vector<Entry> Slot;
+    typedef std::array<Slot, SlotsCount> Level;
+
+    struct LevelInfo
+    {
+        Level m_slots;
+        std::size_t m_count = 0U;
+    };
+
+    std::uint64_t toTick(TimePoint time) const;
+    TimePoint fromTick(std::uint64_t tick) const;
+    void insert(Entry&& entry);
+    void cascade();
+    void cascadeOverflow();
+    void takeSlot(Slot& slot, TimePoint now, std::vector<Entry>& due, std::size_t& count);
+
+    std::array<LevelInfo, LevelsCount> m_levels;
+    std::vector<Entry> m_overflow; // Too far in the future for the top level
+    std::vector<Entry> m_due;
+    TimePoint m_start;
+    std::uint64_t m_current = 0U;
+    std::uint64_t m_nextSeq = 0U;
+};
+
+}  // namespace comms_champion
+
@@ -0,0 +1,42 @@
+//
+// Copyright 2017 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "MsgThread.h"
+
+#include "comms_champion/property/message.h"
+
+namespace comms_champion
+{
+
+void moveMsgToThread(Message& msg, QThread* thread)
+{
+    msg.moveToThread(thread);
+
+    auto moveAttachedFunc =
+        [thread](const MessagePtr& attached)
+        {
+            if (attached) {
+                attached->moveToThread(thread);
+            }
+        };
+
+    moveAttachedFunc(property::message::TransportMsg().getFrom(msg));
+    moveAttachedFunc(property::message::RawDataMsg().getFrom(msg));
+    moveAttachedFunc(property::message::ExtraInfoMsg().getFrom(msg));
+}
+
+}  // namespace comms_champion
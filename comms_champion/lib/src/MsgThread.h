@@ -0,0 +1,37 @@
+//
+// Copyright 2017 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#pragma once
+
+#include "comms/CompileControl.h"
+
+CC_DISABLE_WARNINGS()
+#include <QtCore/QThread>
+CC_ENABLE_WARNINGS()
+
+#include "comms_champion/Message.h"
+
+namespace comms_champion
+{
+
+/// @brief Move message, decoded on a worker thread, together with its
+///     attached messages (transport, raw data, extra info) to the
+///     provided thread.
+void moveMsgToThread(Message& msg, QThread* thread);
+
+}  // namespace comms_champion
@@ -0,0 +1,315 @@
+//
+// Copyright 2017 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "comms_champion/ParallelParser.h"
+
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <chrono>
+#include <algorithm>
+#include <iterator>
+#include <limits>
+#include <cassert>
+
+#include "comms/CompileControl.h"
+
+CC_DISABLE_WARNINGS()
+#include <QtCore/QThread>
+CC_ENABLE_WARNINGS()
+
+#include "MsgThread.h"
+
+namespace comms_champion
+{
+
+namespace
+{
+
+template <typename TFunc>
+void runOnPool(unsigned threadsCount, std::size_t itemsCount, TFunc&& func)
+{
+    std::atomic<std::size_t> nextItem(0U);
+    auto workerFunc =
+        [&nextItem, itemsCount, &func](unsigned threadIdx)
+        {
+            while (true) {
+                auto idx = nextItem.fetch_add(1U);
+                if (itemsCount <= idx) {
+                    break;
+                }
+                func(threadIdx, idx);
+            }
+        };
+
+    std::vector<std::thread> threads;
+    threads.reserve(threadsCount - 1U);
+    for (unsigned idx = 1U; idx < threadsCount; ++idx) {
+        threads.emplace_back(workerFunc, idx);
+    }
+
+    workerFunc(0U);
+    for (auto& t : threads) {
+        t.join();
+    }
+}
+
+// Number of decoded chunks per worker thread waiting to be dispatched
+const std::size_t MaxChunksAheadPerThread = 2U;
+
+const std::size_t NoFrameStart = std::numeric_limits<std::size_t>::max();
+
+}  // namespace
+
+double ParallelParser::Stats::throughput() const
+{
+    if (m_elapsedMs == 0U) {
+        return 0.0;
+    }
+
+    static const double MegaByte = 1024.0 * 1024.0;
+    return (static_cast<double>(m_bytes) / MegaByte) /
+           (static_cast<double>(m_elapsedMs) / 1000.0);
+}
+
+ParallelParser::ParallelParser() = default;
+ParallelParser::~ParallelParser() = default;
+
+void ParallelParser::setProtocolCreateFunc(ProtocolCreateFunc&& func)
+{
+    m_protocolCreateFunc = std::move(func);
+}
+
+void ParallelParser::setDispatchFunc(DispatchFunc&& func)
+{
+    m_dispatchFunc = std::move(func);
+}
+
+void ParallelParser::setThreadsCount(unsigned count)
+{
+    m_threadsCount = count;
+}
+
+void ParallelParser::setChunkSize(std::size_t size)
+{
+    m_chunkSize = std::max(size, std::size_t(1U));
+}
+
+void ParallelParser::setFrameSearchLimit(std::size_t limit)
+{
+    m_frameSearchLimit = limit;
+}
+
+void ParallelParser::parse(
+    const std::uint8_t* data,
+    std::size_t size)
+{
+    m_lastStats = Stats();
+    if ((!m_protocolCreateFunc) || (data == nullptr) || (size == 0U)) {
+        return;
+    }
+
+    auto startTime = std::chrono::steady_clock::now();
+    auto chunksCount = ((size - 1U) / m_chunkSize) + 1U;
+    auto threads =
+        static_cast<unsigned>(
+            std::min(static_cast<std::size_t>(threadsCount()), chunksCount));
+
+    // Protocol plugins are not required to be thread safe, create all the
+    // instances in the calling thread.
+    std::vector<ProtocolPtr> protocols;
+    protocols.reserve(threads);
+    for (unsigned idx = 0U; idx < threads; ++idx) {
+        auto protocol = m_protocolCreateFunc();
+        if (!protocol) {
+            assert(!"Protocol wasn't created");
+            return;
+        }
+        protocols.push_back(std::move(protocol));
+    }
+
+    if (!protocols.front()->canFindFrameStart()) {
+        chunksCount = 1U;
+        threads = 1U;
+        protocols.resize(threads);
+    }
+
+    auto boundaries = findBoundaries(protocols, data, size, chunksCount);
+    assert(boundaries.size() == (chunksCount + 1U));
+
+    auto* callingThread = QThread::currentThread();
+    auto maxChunksAhead = threads * MaxChunksAheadPerThread;
+    std::mutex lock;
+    std::condition_variable cond;
+    std::vector<MessagesList> results(chunksCount);
+    std::vector<bool> decoded(chunksCount, false);
+    std::size_t nextChunk = 0U;
+    std::size_t dispatchedCount = 0U;
+
+    auto workerFunc =
+        [&](unsigned threadIdx)
+        {
+            while (true) {
+                std::size_t chunkIdx = 0U;
+                {
+                    std::unique_lock<std::mutex> guard(lock);
+                    cond.wait(
+                        guard,
+                        [&nextChunk, &dispatchedCount, chunksCount, maxChunksAhead]() -> bool
+                        {
+                            return (chunksCount <= nextChunk) ||
+                                   (nextChunk < (dispatchedCount + maxChunksAhead));
+                        });
+
+                    if (chunksCount <= nextChunk) {
+                        break;
+                    }
+
+                    chunkIdx = nextChunk;
+                    ++nextChunk;
+                }
+
+                MessagesList msgs;
+                auto chunkBeg = boundaries[chunkIdx];
+                auto chunkEnd = boundaries[chunkIdx + 1];
+                if (chunkBeg < chunkEnd) {
+                    DataInfo dataInfo;
+                    dataInfo.m_timestamp = DataInfo::TimestampClock::now();
+                    dataInfo.m_data.assign(data + chunkBeg, data + chunkEnd);
+                    msgs = protocols[threadIdx]->read(dataInfo, true);
+
+                    // Message objects are QObjects, they are used by the
+                    // thread calling parse() only.
+                    for (auto& msg : msgs) {
+                        assert(msg);
+                        moveMsgToThread(*msg, callingThread);
+                    }
+                }
+
+                {
+                    std::lock_guard<std::mutex> guard(lock);
+                    results[chunkIdx] = std::move(msgs);
+                    decoded[chunkIdx] = true;
+                }
+                cond.notify_all();
+            }
+        };
+
+    std::vector<std::thread> workers;
+    workers.reserve(threads);
+    for (unsigned idx = 0U; idx < threads; ++idx) {
+        workers.emplace_back(workerFunc, idx);
+    }
+
+    for (std::size_t chunkIdx = 0U; chunkIdx < chunksCount; ++chunkIdx) {
+        MessagesList msgs;
+        {
+            std::unique_lock<std::mutex> guard(lock);
+            cond.wait(
+                guard,
+                [&decoded, chunkIdx]() -> bool
+                {
+                    return decoded[chunkIdx];
+                });
+
+            msgs = std::move(results[chunkIdx]);
+            dispatchedCount = chunkIdx + 1U;
+        }
+        cond.notify_all();
+
+        m_lastStats.m_messages += msgs.size();
+        if (m_dispatchFunc) {
+            m_dispatchFunc(std::move(msgs));
+        }
+    }
+
+    for (auto& t : workers) {
+        t.join();
+    }
+
+    auto endTime = std::chrono::steady_clock::now();
+    m_lastStats.m_bytes = size;
+    m_lastStats.m_chunks = chunksCount;
+    m_lastStats.m_threads = threads;
+    m_lastStats.m_elapsedMs =
+        static_cast<unsigned long long>(
+            std::chrono::duration_cast<std::chrono::milliseconds>(
+                endTime - startTime).count());
+}
+
+const ParallelParser::Stats& ParallelParser::lastStats() const
+{
+    return m_lastStats;
+}
+
+unsigned ParallelParser::threadsCount() const
+{
+    if (m_threadsCount != 0U) {
+        return m_threadsCount;
+    }
+
+    return std::max(std::thread::hardware_concurrency(), 1U);
+}
+
+ParallelParser::BoundariesList ParallelParser::findBoundaries(
+    std::vector<ProtocolPtr>& protocols,
+    const std::uint8_t* data,
+    std::size_t size,
+    std::size_t chunksCount)
+{
+    BoundariesList boundaries(chunksCount + 1U, size);
+    boundaries[0] = 0U;
+    if (chunksCount <= 1U) {
+        return boundaries;
+    }
+
+    auto chunkSize = m_chunkSize;
+    auto searchLimit = m_frameSearchLimit;
+    runOnPool(
+        static_cast<unsigned>(protocols.size()),
+        chunksCount - 1U,
+        [&protocols, &boundaries, data, size, chunkSize, searchLimit](unsigned threadIdx, std::size_t idx)
+        {
+            auto chunkIdx = idx + 1U;
+            auto nominal = chunkIdx * chunkSize;
+            assert(nominal < size);
+            auto remSize = size - nominal;
+            auto offset =
+                protocols[threadIdx]->findFrameStart(data + nominal, remSize, searchLimit);
+            if (remSize <= offset) {
+                boundaries[chunkIdx] = NoFrameStart;
+                return;
+            }
+
+            boundaries[chunkIdx] = nominal + offset;
+        });
+
+    // When no frame start is found, the chunk is merged with the previous one.
+    for (auto idx = boundaries.size() - 2U; 0U < idx; --idx) {
+        if (boundaries[idx] == NoFrameStart) {
+            boundaries[idx] = boundaries[idx + 1];
+        }
+    }
+
+    for (std::size_t idx = 1U; idx < boundaries.size(); ++idx) {
+        boundaries[idx] = std::max(boundaries[idx], boundaries[idx - 1]);
+    }
+    return boundaries;
+}
+
+}  // namespace comms_champion
@@ -34,6 +34,11 @@ void PluginMgr::setPluginsDir(const QString& pluginDir)
     m_impl->setPluginsDir(pluginDir);
 }
 
+void PluginMgr::setPluginsIndexFile(const QString& filename)
+{
+    m_impl->setPluginsIndexFile(filename);
+}
+
 const PluginMgr::ListOfPluginInfos& PluginMgr::getAvailablePlugins()
 {
     return m_impl->getAvailablePlugins();
@@ -114,6 +119,11 @@ const QString& PluginMgr::getFilesFilter()
     return PluginMgrImpl::getFilesFilter();
 }
 
+const PluginMgr::Stats& PluginMgr::getStats() const
+{
+    return m_impl->getStats();
+}
+
 }  // namespace comms_champion
 
 
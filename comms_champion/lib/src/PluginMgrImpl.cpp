@@ -21,6 +21,7 @@
 #include <algorithm>
 #include <type_traits>
 #include <iostream>
+#include <chrono>
 
 #include "comms/CompileControl.h"
 
@@ -29,7 +30,13 @@ CC_DISABLE_WARNINGS()
 #include <QtCore/QVariantList>
 #include <QtCore/QDir>
 #include <QtCore/QJsonArray>
+#include <QtCore/QJsonDocument>
 #include <QtCore/QVariantList>
+#include <QtCore/QFile>
+#include <QtCore/QFileInfo>
+#include <QtCore/QSaveFile>
+#include <QtCore/QDateTime>
+#include <QtCore/QStandardPaths>
 CC_ENABLE_WARNINGS()
 
 #include "comms_champion/Plugin.h"
@@ -47,6 +54,34 @@ const QString NameMetaKey("name");
 const QString DescMetaKey("desc");
 const QString TypeMetaKey("type");
 
+const QString IndexVersionKey("version");
+const QString IndexPluginsKey("plugins");
+const QString IndexSizeKey("size");
+const QString IndexMtimeKey("mtime");
+const QString IndexIidKey("iid");
+const QString IndexNameKey("name");
+const QString IndexDescKey("desc");
+const QString IndexTypeKey("type");
+const int IndexVersion = 1;
+
+QString defaultIndexFile()
+{
+    auto cacheDir = QStandardPaths::writableLocation(QStandardPaths::GenericCacheLocation);
+    if (cacheDir.isEmpty()) {
+        return QString();
+    }
+
+    return cacheDir + "/comms_champion/plugins_index.json";
+}
+
+unsigned long long elapsedMs(std::chrono::steady_clock::time_point startTime)
+{
+    return
+        static_cast<unsigned long long>(
+            std::chrono::duration_cast<std::chrono::milliseconds>(
+                std::chrono::steady_clock::now() - startTime).count());
+}
+
 struct PluginLoaderDeleter
 {
     void operator()(QPluginLoader* loader)
@@ -86,7 +121,10 @@ PluginMgrImpl::PluginInfo::Type parseType(const QString& val)
 
 }  // namespace
 
-PluginMgrImpl::PluginMgrImpl() = default;
+PluginMgrImpl::PluginMgrImpl()
+  : m_indexFile(defaultIndexFile())
+{
+}
 
 PluginMgrImpl::~PluginMgrImpl()
 {
@@ -104,19 +142,53 @@ void PluginMgrImpl::setPluginsDir(const QString& pluginDir)
     m_pluginDir = pluginDir;
 }
 
+void PluginMgrImpl::setPluginsIndexFile(const QString& filename)
+{
+    m_indexFile = filename;
+}
+
 const PluginMgrImpl::ListOfPluginInfos& PluginMgrImpl::getAvailablePlugins()
 {
     if (!m_plugins.empty()) {
         return m_plugins;
     }
 
+    auto startTime = std::chrono::steady_clock::now();
+    m_stats.m_cached = 0U;
+    auto index = loadIndex();
+    QJsonObject updatedIndex;
+    bool indexChanged = false;
     do {
         QDir pluginDir(m_pluginDir);
         auto files =
-            pluginDir.entryList(QDir::Files | QDir::NoDotAndDotDot, QDir::Name);
+            pluginDir.entryInfoList(QDir::Files | QDir::NoDotAndDotDot, QDir::Name);
+
+        for (auto& fileInfo : files) {
+            auto f = fileInfo.fileName();
+            auto path = fileInfo.absoluteFilePath();
+            auto size = static_cast<double>(fileInfo.size());
+            auto mtime = static_cast<double>(fileInfo.lastModified().toMSecsSinceEpoch());
+
+            // The library is inspected only when it has changed since
+            // its metadata was indexed.
+            PluginInfoPtr infoPtr;
+            auto entry = index.value(path).toObject();
+            bool cached =
+                (!entry.isEmpty()) &&
+                (entry.value(IndexSizeKey).toDouble() == size) &&
+                (entry.value(IndexMtimeKey).toDouble() == mtime);
+            if (cached) {
+                infoPtr = readIndexedPluginInfo(f, entry);
+            }
+            else {
+                infoPtr = readPluginInfo(f);
+                entry = makeIndexEntry(infoPtr.get());
+                entry.insert(IndexSizeKey, size);
+                entry.insert(IndexMtimeKey, mtime);
+                indexChanged = true;
+            }
 
-        for (auto& f : files) {
-            auto infoPtr = readPluginInfo(f);
+            updatedIndex.insert(path, entry);
             if (!infoPtr) {
                 continue;
             }
@@ -127,10 +199,33 @@ const PluginMgrImpl::ListOfPluginInfos& PluginMgrImpl::getAvailablePlugins()
                 continue;
             }
 
+            if (cached) {
+                ++m_stats.m_cached;
+            }
+
             m_plugins.push_back(std::move(infoPtr));
         }
     } while (false);
 
+    for (auto iter = index.begin(); iter != index.end(); ++iter) {
+        if (!updatedIndex.contains(iter.key())) {
+            // Removed from the plugins directory
+            if (QFileInfo(iter.key()).absolutePath() == QDir(m_pluginDir).absolutePath()) {
+                indexChanged = true;
+                continue;
+            }
+
+            // Belongs to other plugins directory
+            updatedIndex.insert(iter.key(), iter.value());
+        }
+    }
+
+    if (indexChanged) {
+        saveIndex(updatedIndex);
+    }
+
+    m_stats.m_available = static_cast<unsigned>(m_plugins.size());
+    m_stats.m_scanMs = elapsedMs(startTime);
     return m_plugins;
 }
 
@@ -148,6 +243,8 @@ PluginMgrImpl::ListOfPluginInfos PluginMgrImpl::loadPluginsFromConfig(
     const QVariantMap& config)
 {
     ListOfPluginInfos pluginInfos;
+    auto& availPlugins = getAvailablePlugins();
+    auto startTime = std::chrono::steady_clock::now();
     do {
         auto listVar = config.value(PluginsKey);
         if ((!listVar.isValid()) || (!listVar.canConvert<QVariantList>())) {
@@ -155,7 +252,6 @@ PluginMgrImpl::ListOfPluginInfos PluginMgrImpl::loadPluginsFromConfig(
         }
 
         auto varList = listVar.value<QVariantList>();
-        auto& availPlugins = getAvailablePlugins();
         for (auto& iidVar : varList) {
             if ((!iidVar.isValid()) || (!iidVar.canConvert<QString>())) {
                 continue;
@@ -186,6 +282,9 @@ PluginMgrImpl::ListOfPluginInfos PluginMgrImpl::loadPluginsFromConfig(
 
     } while (false);
 
+    m_stats.m_loaded = static_cast<unsigned>(pluginInfos.size());
+    m_stats.m_loadMs = elapsedMs(startTime);
+
     return pluginInfos;
 }
 
@@ -314,6 +413,11 @@ const QString& PluginMgrImpl::getFilesFilter()
     return ConfigMgr::getFilesFilter();
 }
 
+const PluginMgrImpl::Stats& PluginMgrImpl::getStats() const
+{
+    return m_stats;
+}
+
 PluginMgrImpl::PluginInfoPtr PluginMgrImpl::readPluginInfo(const QString& filename)
 {
     PluginInfoPtr ptr;
@@ -378,6 +482,91 @@ PluginMgrImpl::PluginInfoPtr PluginMgrImpl::readPluginInfo(const QString& filena
     return ptr;
 }
 
+PluginMgrImpl::PluginInfoPtr PluginMgrImpl::readIndexedPluginInfo(
+    const QString& filename,
+    const QJsonObject& entry)
+{
+    auto iid = entry.value(IndexIidKey).toString();
+    if (iid.isEmpty()) {
+        // Not a plugin
+        return PluginInfoPtr();
+    }
+
+    PluginInfoPtr ptr(new PluginInfo());
+    ptr->m_loader.reset(new QPluginLoader(filename));
+    ptr->m_iid = iid;
+    ptr->m_name = entry.value(IndexNameKey).toString();
+    ptr->m_desc = entry.value(IndexDescKey).toString();
+
+    auto type = entry.value(IndexTypeKey).toInt();
+    if ((type < 0) || (static_cast<int>(PluginInfo::Type::NumOfValues) <= type)) {
+        type = static_cast<int>(PluginInfo::Type::Invalid);
+    }
+    ptr->m_type = static_cast<PluginInfo::Type>(type);
+    return ptr;
+}
+
+QJsonObject PluginMgrImpl::makeIndexEntry(const PluginInfo* info)
+{
+    QJsonObject entry;
+    if (info == nullptr) {
+        return entry;
+    }
+
+    entry.insert(IndexIidKey, info->m_iid);
+    entry.insert(IndexNameKey, info->m_name);
+    entry.insert(IndexDescKey, info->m_desc);
+    entry.insert(IndexTypeKey, static_cast<int>(info->m_type));
+    return entry;
+}
+
+QJsonObject PluginMgrImpl::loadIndex() const
+{
+    if (m_indexFile.isEmpty()) {
+        return QJsonObject();
+    }
+
+    QFile indexFile(m_indexFile);
+    if (!indexFile.open(QIODevice::ReadOnly)) {
+        return QJsonObject();
+    }
+
+    auto doc = QJsonDocument::fromJson(indexFile.readAll());
+    if (!doc.isObject()) {
+        return QJsonObject();
+    }
+
+    auto topObj = doc.object();
+    if (topObj.value(IndexVersionKey).toInt() != IndexVersion) {
+        return QJsonObject();
+    }
+
+    return topObj.value(IndexPluginsKey).toObject();
+}
+
+void PluginMgrImpl::saveIndex(const QJsonObject& plugins) const
+{
+    if (m_indexFile.isEmpty()) {
+        return;
+    }
+
+    QDir().mkpath(QFileInfo(m_indexFile).absolutePath());
+
+    // Replaced atomically, other instances may read it at the same time
+    QSaveFile indexFile(m_indexFile);
+    if (!indexFile.open(QIODevice::WriteOnly)) {
+        std::cerr << "WARNING: failed to update plugins index " <<
+            m_indexFile.toStdString() << std::endl;
+        return;
+    }
+
+    QJsonObject topObj;
+    topObj.insert(IndexVersionKey, IndexVersion);
+    topObj.insert(IndexPluginsKey, plugins);
+    indexFile.write(QJsonDocument(topObj).toJson(QJsonDocument::Compact));
+    indexFile.commit();
+}
+
 }  // namespace comms_champion
 
 
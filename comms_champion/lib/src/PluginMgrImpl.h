@@ -29,6 +29,7 @@ CC_DISABLE_WARNINGS()
 #include <QtCore/QString>
 #include <QtCore/QVariantMap>
 #include <QtCore/QPluginLoader>
+#include <QtCore/QJsonObject>
 CC_ENABLE_WARNINGS()
 
 #include "comms_champion/Plugin.h"
@@ -48,11 +49,13 @@ public:
     typedef PluginMgr::PluginInfoPtr PluginInfoPtr;
     typedef PluginMgr::ListOfPluginInfos ListOfPluginInfos;
     typedef Plugin::WidgetPtr WidgetPtr;
+    typedef PluginMgr::Stats Stats;
 
     PluginMgrImpl();
     ~PluginMgrImpl();
 
     void setPluginsDir(const QString& pluginDir);
+    void setPluginsIndexFile(const QString& filename);
     const ListOfPluginInfos& getAvailablePlugins();
     const ListOfPluginInfos& getAppliedPlugins() const;
     void setAppliedPlugins(const ListOfPluginInfos& plugins);
@@ -68,13 +71,20 @@ public:
     static QVariantMap getConfigForPlugins(const ListOfPluginInfos& infos);
     const QString& getLastFile() const;
     static const QString& getFilesFilter();
+    const Stats& getStats() const;
 
 private:
     typedef std::list<PluginLoaderPtr> PluginLoadersList;
 
     PluginInfoPtr readPluginInfo(const QString& filename);
+    PluginInfoPtr readIndexedPluginInfo(const QString& filename, const QJsonObject& entry);
+    static QJsonObject makeIndexEntry(const PluginInfo* info);
+    QJsonObject loadIndex() const;
+    void saveIndex(const QJsonObject& plugins) const;
 
     QString m_pluginDir;
+    QString m_indexFile;
+    Stats m_stats;
     ListOfPluginInfos m_plugins;
     ListOfPluginInfos m_appliedPlugins;
     ConfigMgr m_configMgr;
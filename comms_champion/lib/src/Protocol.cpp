@@ -17,6 +17,8 @@
 
 #include "comms_champion/Protocol.h"
 
+#include <algorithm>
+
 #include "comms/CompileControl.h"
 
 CC_DISABLE_WARNINGS()
@@ -44,6 +46,23 @@ Protocol::MessagesList Protocol::read(
     return readImpl(dataInfo, final);
 }
 
+bool Protocol::canFindFrameStart() const
+{
+    return canFindFrameStartImpl();
+}
+
+std::size_t Protocol::findFrameStart(
+    const std::uint8_t* data,
+    std::size_t size,
+    std::size_t maxOffset)
+{
+    if ((data == nullptr) || (size == 0U) || (maxOffset == 0U)) {
+        return size;
+    }
+
+    return findFrameStartImpl(data, size, std::min(size, maxOffset));
+}
+
 DataInfoPtr Protocol::write(Message& msg)
 {
 
@@ -169,6 +188,21 @@ MessagePtr Protocol::createInvalidMessage(const MsgDataSeq& data)
     return invalidMsg;
 }
 
+bool Protocol::canFindFrameStartImpl() const
+{
+    return false;
+}
+
+std::size_t Protocol::findFrameStartImpl(
+    const std::uint8_t* data,
+    std::size_t size,
+    std::size_t maxOffset)
+{
+    static_cast<void>(data);
+    static_cast<void>(maxOffset);
+    return size;
+}
+
 void Protocol::setNameToMessageProperties(Message& msg)
 {
     property::message::ProtocolName().setTo(name(), msg);
@@ -79,6 +79,11 @@ unsigned Socket::connectionProperties() const
     return connectionPropertiesImpl();
 }
 
+std::size_t Socket::pendingSendBytes() const
+{
+    return pendingSendBytesImpl();
+}
+
 bool Socket::startImpl()
 {
     return true;
@@ -102,6 +107,11 @@ unsigned Socket::connectionPropertiesImpl() const
     return 0U;
 }
 
+std::size_t Socket::pendingSendBytesImpl() const
+{
+    return 0U;
+}
+
 void Socket::reportDataReceived(DataInfoPtr dataPtr)
 {
     if ((!m_running) || (!m_dataReceivedCallback)) {
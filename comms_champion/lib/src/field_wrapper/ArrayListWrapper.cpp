@@ -90,6 +90,15 @@ ArrayListWrapper::PrefixFieldInfo ArrayListWrapper::getPrefixFieldInfo() const
     return getPrefixFieldInfoImpl();
 }
 
+bool ArrayListWrapper::rebindMembersImpl(FieldWrapper& other)
+{
+    static_cast<void>(other);
+    // Elements are stored outside the field object, wrap the ones of
+    // the newly bound field.
+    refreshMembers();
+    return true;
+}
+
 void ArrayListWrapper::dispatchImpl(FieldWrapperHandler& handler)
 {
     handler.handle(*this);
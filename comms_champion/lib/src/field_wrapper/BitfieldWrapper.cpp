@@ -57,6 +57,21 @@ BitfieldWrapper::Ptr BitfieldWrapper::clone()
     return ptr;
 }
 
+bool BitfieldWrapper::rebindMembersImpl(FieldWrapper& other)
+{
+    auto& otherMembers = static_cast<BitfieldWrapper&>(other).getMembers();
+    if (otherMembers.size() != m_members.size()) {
+        return false;
+    }
+
+    for (auto idx = 0U; idx < m_members.size(); ++idx) {
+        if (!m_members[idx]->rebind(*otherMembers[idx])) {
+            return false;
+        }
+    }
+    return true;
+}
+
 void BitfieldWrapper::dispatchImpl(FieldWrapperHandler& handler)
 {
     handler.handle(*this);
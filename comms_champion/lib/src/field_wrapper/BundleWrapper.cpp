@@ -57,6 +57,21 @@ BundleWrapper::Ptr BundleWrapper::clone()
     return ptr;
 }
 
+bool BundleWrapper::rebindMembersImpl(FieldWrapper& other)
+{
+    auto& otherMembers = static_cast<BundleWrapper&>(other).getMembers();
+    if (otherMembers.size() != m_members.size()) {
+        return false;
+    }
+
+    for (auto idx = 0U; idx < m_members.size(); ++idx) {
+        if (!m_members[idx]->rebind(*otherMembers[idx])) {
+            return false;
+        }
+    }
+    return true;
+}
+
 void BundleWrapper::dispatchImpl(FieldWrapperHandler& handler)
 {
     handler.handle(*this);
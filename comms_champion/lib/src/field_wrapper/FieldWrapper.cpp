@@ -98,6 +98,21 @@ FieldWrapper::BasePtr FieldWrapper::upClone()
     return upCloneImpl();
 }
 
+bool FieldWrapper::rebind(FieldWrapper& other)
+{
+    if (!rebindImpl(other)) {
+        return false;
+    }
+
+    return rebindMembersImpl(other);
+}
+
+bool FieldWrapper::rebindMembersImpl(FieldWrapper& other)
+{
+    static_cast<void>(other);
+    return true;
+}
+
 }  // namespace field_wrapper
 
 }  // namespace comms_champion
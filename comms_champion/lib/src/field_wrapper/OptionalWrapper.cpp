@@ -66,6 +66,16 @@ OptionalWrapper::Ptr OptionalWrapper::clone()
     return ptr;
 }
 
+bool OptionalWrapper::rebindMembersImpl(FieldWrapper& other)
+{
+    auto& otherOpt = static_cast<OptionalWrapper&>(other);
+    if ((!hasFieldWrapper()) || (!otherOpt.hasFieldWrapper())) {
+        return hasFieldWrapper() == otherOpt.hasFieldWrapper();
+    }
+
+    return m_fieldWrapper->rebind(otherOpt.getFieldWrapper());
+}
+
 void OptionalWrapper::dispatchImpl(FieldWrapperHandler& handler)
 {
     handler.handle(*this);
@@ -78,6 +78,22 @@ int VariantWrapper::getMembersCount() const
     return getMembersCountImpl();
 }
 
+bool VariantWrapper::rebindMembersImpl(FieldWrapper& other)
+{
+    auto& otherVariant = static_cast<VariantWrapper&>(other);
+    m_createMemberCb = otherVariant.m_createMemberCb;
+    auto& otherCurrent = otherVariant.getCurrent();
+    if (!otherCurrent) {
+        m_current.reset();
+        return true;
+    }
+
+    if ((!m_current) || (!m_current->rebind(*otherCurrent))) {
+        m_current = otherCurrent->upClone();
+    }
+    return true;
+}
+
 void VariantWrapper::dispatchImpl(FieldWrapperHandler& handler)
 {
     handler.handle(*this);
@@ -62,6 +62,9 @@ const QByteArray RepeatDurationUnits::PropName = RepeatDurationUnits::Name.toUtf
 const QString RepeatCount::Name("cc.msg_repeat_count");
 const QByteArray RepeatCount::PropName = RepeatCount::Name.toUtf8();
 
+const QString FrameCacheKey::Name("cc.msg_frame_cache_key");
+const QByteArray FrameCacheKey::PropName = FrameCacheKey::Name.toUtf8();
+
 const QString ScrollPos::Name("cc.msg_scroll_pos");
 const QByteArray ScrollPos::PropName = ScrollPos::Name.toUtf8();
 
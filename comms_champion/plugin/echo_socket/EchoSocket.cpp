@@ -49,6 +49,16 @@ unsigned EchoSocket::connectionPropertiesImpl() const
     return ConnectionProperty_Autoconnect | ConnectionProperty_NonDisconnectable;
 }
 
+std::size_t EchoSocket::pendingSendBytesImpl() const
+{
+    std::size_t result = 0U;
+    for (auto& dataPtr : m_pendingData) {
+        assert(dataPtr);
+        result += dataPtr->m_data.size();
+    }
+    return result;
+}
+
 void EchoSocket::sendDataPostponed()
 {
     m_timerActive = false;
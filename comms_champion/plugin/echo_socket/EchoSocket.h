@@ -42,6 +42,7 @@ public:
 protected:
     virtual void sendDataImpl(DataInfoPtr dataPtr) override;
     virtual unsigned connectionPropertiesImpl() const override;
+    virtual std::size_t pendingSendBytesImpl() const override;
 
 private slots:
     void sendDataPostponed();
@@ -0,0 +1,289 @@
+//
+// Copyright 2017 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#include "FileSocket.h"
+
+#include <cassert>
+#include <algorithm>
+
+namespace comms_champion
+{
+
+namespace plugin
+{
+
+namespace file_socket
+{
+
+namespace
+{
+
+const std::size_t PcapHeaderLen = 24U;
+const std::size_t PcapRecordHeaderLen = 16U;
+const std::uint32_t PcapMagic = 0xa1b2c3d4;
+const std::uint32_t PcapNanoMagic = 0xa1b23c4d;
+const std::size_t MaxBytesPerIteration = 64U * 1024U;
+const unsigned MaxPacketsPerIteration = 256U;
+
+std::uint32_t swapBytes(std::uint32_t value)
+{
+    return ((value & 0xff) << 24) |
+           ((value & 0xff00) << 8) |
+           ((value >> 8) & 0xff00) |
+           ((value >> 24) & 0xff);
+}
+
+}  // namespace
+
+FileSocket::FileSocket()
+{
+    m_timer.setSingleShot(true);
+    connect(
+        &m_timer, SIGNAL(timeout()),
+        this, SLOT(feedData()));
+}
+
+FileSocket::~FileSocket()
+{
+    closeFile();
+}
+
+bool FileSocket::socketConnectImpl()
+{
+    closeFile();
+    m_file.setFileName(m_filePath);
+    if (!m_file.open(QIODevice::ReadOnly)) {
+        static const QString FailedToOpenError(
+            tr("Failed to open capture file."));
+        reportError(FailedToOpenError);
+        return false;
+    }
+
+    auto fileSize = m_file.size();
+    if (0 < fileSize) {
+        m_data = m_file.map(0, fileSize);
+        if (m_data == nullptr) {
+            static const QString FailedToMapError(
+                tr("Failed to map capture file to memory."));
+            reportError(FailedToMapError);
+            m_file.close();
+            return false;
+        }
+        m_size = static_cast<std::size_t>(fileSize);
+    }
+
+    m_pos = 0U;
+    m_replayStarted = false;
+    if ((m_format == Format::Pcap) && (!readPcapHeader())) {
+        static const QString InvalidPcapError(
+            tr("Capture file doesn't have valid pcap header."));
+        reportError(InvalidPcapError);
+        closeFile();
+        return false;
+    }
+
+    m_timer.start(0);
+    return true;
+}
+
+void FileSocket::socketDisconnectImpl()
+{
+    closeFile();
+}
+
+void FileSocket::sendDataImpl(DataInfoPtr dataPtr)
+{
+    // Input only socket, outgoing data is dropped
+    static_cast<void>(dataPtr);
+}
+
+void FileSocket::feedData()
+{
+    if (!m_file.isOpen()) {
+        return;
+    }
+
+    bool more = false;
+    if (m_format == Format::Pcap) {
+        more = feedPcapData();
+    }
+    else {
+        more = feedRawData();
+    }
+
+    if (more) {
+        return;
+    }
+
+    closeFile();
+    reportDisconnected();
+}
+
+bool FileSocket::readPcapHeader()
+{
+    if (m_size < PcapHeaderLen) {
+        return false;
+    }
+
+    m_bigEndian = false;
+    auto magic = readU32(0U);
+    if ((magic != PcapMagic) && (magic != PcapNanoMagic)) {
+        m_bigEndian = true;
+        magic = readU32(0U);
+    }
+
+    if ((magic != PcapMagic) && (magic != PcapNanoMagic)) {
+        return false;
+    }
+
+    m_nanoRes = (magic == PcapNanoMagic);
+    m_pos = PcapHeaderLen;
+    return true;
+}
+
+bool FileSocket::feedRawData()
+{
+    auto chunkSize = std::max(m_chunkSize, 1U);
+    std::size_t fedBytes = 0U;
+    while ((m_pos < m_size) && (fedBytes < MaxBytesPerIteration)) {
+        auto len = std::min(static_cast<std::size_t>(chunkSize), m_size - m_pos);
+        auto dataInfoPtr = makeDataInfo();
+        dataInfoPtr->m_timestamp = DataInfo::TimestampClock::now();
+        dataInfoPtr->m_data.assign(m_data + m_pos, m_data + m_pos + len);
+        m_pos += len;
+        fedBytes += len;
+        reportDataReceived(std::move(dataInfoPtr));
+        if (!m_file.isOpen()) {
+            // Disconnected during report
+            return true;
+        }
+    }
+
+    if (m_size <= m_pos) {
+        return false;
+    }
+
+    m_timer.start(0);
+    return true;
+}
+
+bool FileSocket::feedPcapData()
+{
+    for (unsigned count = 0U; count < MaxPacketsPerIteration; ++count) {
+        if (m_size < (m_pos + PcapRecordHeaderLen)) {
+            return false;
+        }
+
+        std::uint64_t tsSec = readU32(m_pos);
+        std::uint64_t tsFrac = readU32(m_pos + 4U);
+        std::size_t inclLen = readU32(m_pos + 8U);
+        if (m_size < (m_pos + PcapRecordHeaderLen + inclLen)) {
+            return false;
+        }
+
+        static const std::uint64_t NanoInSec = 1000000000ULL;
+        std::uint64_t tsNano = tsSec * NanoInSec;
+        if (m_nanoRes) {
+            tsNano += tsFrac;
+        }
+        else {
+            tsNano += tsFrac * 1000U;
+        }
+
+        if (m_replay == Replay::RealTime) {
+            auto now = ReplayClock::now();
+            if (!m_replayStarted) {
+                m_replayStarted = true;
+                m_firstPacketTs = tsNano;
+                m_replayStart = now;
+            }
+
+            auto due =
+                m_replayStart +
+                std::chrono::duration_cast<ReplayClock::duration>(
+                    std::chrono::nanoseconds(tsNano - std::min(tsNano, m_firstPacketTs)));
+            if (now < due) {
+                auto waitMs =
+                    std::chrono::duration_cast<std::chrono::milliseconds>(due - now).count();
+                m_timer.start(static_cast<int>(waitMs));
+                return true;
+            }
+        }
+
+        auto payloadPos = m_pos + PcapRecordHeaderLen;
+        m_pos = payloadPos + inclLen;
+
+        auto skip = std::min(static_cast<std::size_t>(m_headerSkip), inclLen);
+        if (skip == inclLen) {
+            continue;
+        }
+
+        auto dataInfoPtr = makeDataInfo();
+        dataInfoPtr->m_timestamp =
+            DataInfo::Timestamp(
+                std::chrono::duration_cast<DataInfo::TimestampClock::duration>(
+                    std::chrono::nanoseconds(tsNano)));
+        dataInfoPtr->m_data.assign(m_data + payloadPos + skip, m_data + m_pos);
+        reportDataReceived(std::move(dataInfoPtr));
+        if (!m_file.isOpen()) {
+            // Disconnected during report
+            return true;
+        }
+    }
+
+    m_timer.start(0);
+    return true;
+}
+
+std::uint32_t FileSocket::readU32(std::size_t offset) const
+{
+    assert((offset + sizeof(std::uint32_t)) <= m_size);
+    auto* bytes = m_data + offset;
+    std::uint32_t value =
+        static_cast<std::uint32_t>(bytes[0]) |
+        (static_cast<std::uint32_t>(bytes[1]) << 8) |
+        (static_cast<std::uint32_t>(bytes[2]) << 16) |
+        (static_cast<std::uint32_t>(bytes[3]) << 24);
+
+    if (m_bigEndian) {
+        value = swapBytes(value);
+    }
+    return value;
+}
+
+void FileSocket::closeFile()
+{
+    m_timer.stop();
+    if (m_data != nullptr) {
+        m_file.unmap(const_cast<std::uint8_t*>(m_data));
+        m_data = nullptr;
+    }
+
+    m_size = 0U;
+    m_pos = 0U;
+    if (m_file.isOpen()) {
+        m_file.close();
+    }
+}
+
+}  // namespace file_socket
+
+}  // namespace plugin
+
+}  // namespace comms_champion
+
@@ -0,0 +1,135 @@
+//
+// Copyright 2017 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <chrono>
+
+#include "comms/CompileControl.h"
+
+CC_DISABLE_WARNINGS()
+#include <QtCore/QObject>
+#include <QtCore/QString>
+#include <QtCore/QFile>
+#include <QtCore/QTimer>
+CC_ENABLE_WARNINGS()
+
+#include "comms_champion/Socket.h"
+
+
+namespace comms_champion
+{
+
+namespace plugin
+{
+
+namespace file_socket
+{
+
+class FileSocket : public QObject,
+                   public comms_champion::Socket
+{
+    Q_OBJECT
+    using Base = comms_champion::Socket;
+
+public:
+    enum class Format
+    {
+        Raw,
+        Pcap,
+        NumOfValues
+    };
+
+    enum class Replay
+    {
+        AsFastAsPossible,
+        RealTime,
+        NumOfValues
+    };
+
+    FileSocket();
+    ~FileSocket();
+
+    QString& filePath()
+    {
+        return m_filePath;
+    }
+
+    Format& format()
+    {
+        return m_format;
+    }
+
+    Replay& replay()
+    {
+        return m_replay;
+    }
+
+    unsigned& headerSkip()
+    {
+        return m_headerSkip;
+    }
+
+    unsigned& chunkSize()
+    {
+        return m_chunkSize;
+    }
+
+protected:
+    virtual bool socketConnectImpl() override;
+    virtual void socketDisconnectImpl() override;
+    virtual void sendDataImpl(DataInfoPtr dataPtr) override;
+
+private slots:
+    void feedData();
+
+private:
+    typedef std::chrono::steady_clock ReplayClock;
+
+    bool readPcapHeader();
+    bool feedRawData();
+    bool feedPcapData();
+    std::uint32_t readU32(std::size_t offset) const;
+    void closeFile();
+
+    QFile m_file;
+    QTimer m_timer;
+    QString m_filePath;
+    Format m_format = Format::Raw;
+    Replay m_replay = Replay::AsFastAsPossible;
+    unsigned m_headerSkip = 0U;
+    unsigned m_chunkSize = 1024U;
+
+    const std::uint8_t* m_data = nullptr;
+    std::size_t m_size = 0U;
+    std::size_t m_pos = 0U;
+    bool m_bigEndian = false;
+    bool m_nanoRes = false;
+    bool m_replayStarted = false;
+    std::uint64_t m_firstPacketTs = 0U;
+    ReplayClock::time_point m_replayStart;
+};
+
+}  // namespace file_socket
+
+} // namespace plugin
+
+} // namespace comms_champion
+
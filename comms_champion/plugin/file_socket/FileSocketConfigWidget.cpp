@@ -0,0 +1,136 @@
+//
+// Copyright 2017 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#include "FileSocketConfigWidget.h"
+
+#include <cassert>
+
+#include "comms/CompileControl.h"
+
+CC_DISABLE_WARNINGS()
+#include <QtWidgets/QFileDialog>
+CC_ENABLE_WARNINGS()
+
+namespace comms_champion
+{
+
+namespace plugin
+{
+
+namespace file_socket
+{
+
+FileSocketConfigWidget::FileSocketConfigWidget(
+    FileSocket& socket,
+    QWidget* parentObj)
+  : Base(parentObj),
+    m_socket(socket)
+{
+    m_ui.setupUi(this);
+    m_ui.m_fileLineEdit->setText(m_socket.filePath());
+    m_ui.m_formatComboBox->setCurrentIndex(static_cast<int>(m_socket.format()));
+    m_ui.m_replayComboBox->setCurrentIndex(static_cast<int>(m_socket.replay()));
+    m_ui.m_headerSkipSpinBox->setValue(static_cast<int>(m_socket.headerSkip()));
+    m_ui.m_chunkSizeSpinBox->setValue(static_cast<int>(m_socket.chunkSize()));
+    refreshFormatDependent();
+
+    connect(
+        m_ui.m_fileLineEdit, SIGNAL(textEdited(const QString&)),
+        this, SLOT(fileChanged(const QString&)));
+
+    connect(
+        m_ui.m_browsePushButton, SIGNAL(clicked()),
+        this, SLOT(browseClicked()));
+
+    connect(
+        m_ui.m_formatComboBox, SIGNAL(currentIndexChanged(int)),
+        this, SLOT(formatChanged(int)));
+
+    connect(
+        m_ui.m_replayComboBox, SIGNAL(currentIndexChanged(int)),
+        this, SLOT(replayChanged(int)));
+
+    connect(
+        m_ui.m_headerSkipSpinBox, SIGNAL(valueChanged(int)),
+        this, SLOT(headerSkipChanged(int)));
+
+    connect(
+        m_ui.m_chunkSizeSpinBox, SIGNAL(valueChanged(int)),
+        this, SLOT(chunkSizeChanged(int)));
+}
+
+FileSocketConfigWidget::~FileSocketConfigWidget() = default;
+
+void FileSocketConfigWidget::fileChanged(const QString& value)
+{
+    m_socket.filePath() = value;
+}
+
+void FileSocketConfigWidget::browseClicked()
+{
+    auto filename =
+        QFileDialog::getOpenFileName(
+            this,
+            tr("Select Capture File"),
+            m_socket.filePath());
+
+    if (filename.isEmpty()) {
+        return;
+    }
+
+    m_ui.m_fileLineEdit->setText(filename);
+    m_socket.filePath() = filename;
+}
+
+void FileSocketConfigWidget::formatChanged(int value)
+{
+    assert((0 <= value) && (value < static_cast<int>(FileSocket::Format::NumOfValues)));
+    m_socket.format() = static_cast<FileSocket::Format>(value);
+    refreshFormatDependent();
+}
+
+void FileSocketConfigWidget::replayChanged(int value)
+{
+    assert((0 <= value) && (value < static_cast<int>(FileSocket::Replay::NumOfValues)));
+    m_socket.replay() = static_cast<FileSocket::Replay>(value);
+}
+
+void FileSocketConfigWidget::headerSkipChanged(int value)
+{
+    m_socket.headerSkip() = static_cast<unsigned>(value);
+}
+
+void FileSocketConfigWidget::chunkSizeChanged(int value)
+{
+    m_socket.chunkSize() = static_cast<unsigned>(value);
+}
+
+void FileSocketConfigWidget::refreshFormatDependent()
+{
+    bool pcap = (m_socket.format() == FileSocket::Format::Pcap);
+    m_ui.m_replayComboBox->setEnabled(pcap);
+    m_ui.m_headerSkipSpinBox->setEnabled(pcap);
+    m_ui.m_chunkSizeSpinBox->setEnabled(!pcap);
+}
+
+}  // namespace file_socket
+
+}  // namespace plugin
+
+}  // namespace comms_champion
+
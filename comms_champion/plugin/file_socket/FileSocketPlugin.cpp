@@ -0,0 +1,137 @@
+//
+// Copyright 2017 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#include "FileSocketPlugin.h"
+
+#include <memory>
+#include <cassert>
+
+#include "FileSocket.h"
+#include "FileSocketConfigWidget.h"
+
+namespace comms_champion
+{
+
+namespace plugin
+{
+
+namespace file_socket
+{
+
+namespace
+{
+
+const QString MainConfigKey("cc_file_socket");
+const QString FileSubKey("file");
+const QString FormatSubKey("format");
+const QString ReplaySubKey("replay");
+const QString HeaderSkipSubKey("header_skip");
+const QString ChunkSizeSubKey("chunk_size");
+
+}  // namespace
+
+FileSocketPlugin::FileSocketPlugin()
+{
+    pluginProperties()
+        .setSocketCreateFunc(
+            [this]()
+            {
+                createSocketIfNeeded();
+                return m_socket;
+            })
+        .setConfigWidgetCreateFunc(
+            [this]()
+            {
+                createSocketIfNeeded();
+                return new FileSocketConfigWidget(*m_socket);
+            });
+}
+
+FileSocketPlugin::~FileSocketPlugin() = default;
+
+void FileSocketPlugin::getCurrentConfigImpl(QVariantMap& config)
+{
+    createSocketIfNeeded();
+
+    QVariantMap subConfig;
+    subConfig.insert(FileSubKey, m_socket->filePath());
+    subConfig.insert(FormatSubKey, static_cast<int>(m_socket->format()));
+    subConfig.insert(ReplaySubKey, static_cast<int>(m_socket->replay()));
+    subConfig.insert(HeaderSkipSubKey, m_socket->headerSkip());
+    subConfig.insert(ChunkSizeSubKey, m_socket->chunkSize());
+    config.insert(MainConfigKey, QVariant::fromValue(subConfig));
+}
+
+void FileSocketPlugin::reconfigureImpl(const QVariantMap& config)
+{
+    auto subConfigVar = config.value(MainConfigKey);
+    if ((!subConfigVar.isValid()) || (!subConfigVar.canConvert<QVariantMap>())) {
+        return;
+    }
+
+    createSocketIfNeeded();
+
+    auto subConfig = subConfigVar.value<QVariantMap>();
+    auto fileVar = subConfig.value(FileSubKey);
+    if (fileVar.isValid() && fileVar.canConvert<QString>()) {
+        m_socket->filePath() = fileVar.toString();
+    }
+
+    auto formatVar = subConfig.value(FormatSubKey);
+    if (formatVar.isValid() && formatVar.canConvert<int>()) {
+        auto format = formatVar.value<int>();
+        if ((0 <= format) && (format < static_cast<int>(FileSocket::Format::NumOfValues))) {
+            m_socket->format() = static_cast<FileSocket::Format>(format);
+        }
+    }
+
+    auto replayVar = subConfig.value(ReplaySubKey);
+    if (replayVar.isValid() && replayVar.canConvert<int>()) {
+        auto replay = replayVar.value<int>();
+        if ((0 <= replay) && (replay < static_cast<int>(FileSocket::Replay::NumOfValues))) {
+            m_socket->replay() = static_cast<FileSocket::Replay>(replay);
+        }
+    }
+
+    auto headerSkipVar = subConfig.value(HeaderSkipSubKey);
+    if (headerSkipVar.isValid() && headerSkipVar.canConvert<unsigned>()) {
+        m_socket->headerSkip() = headerSkipVar.value<unsigned>();
+    }
+
+    auto chunkSizeVar = subConfig.value(ChunkSizeSubKey);
+    if (chunkSizeVar.isValid() && chunkSizeVar.canConvert<unsigned>()) {
+        auto chunkSize = chunkSizeVar.value<unsigned>();
+        if (0U < chunkSize) {
+            m_socket->chunkSize() = chunkSize;
+        }
+    }
+}
+
+void FileSocketPlugin::createSocketIfNeeded()
+{
+    if (!m_socket) {
+        m_socket.reset(new FileSocket());
+    }
+}
+
+}  // namespace file_socket
+
+}  // namespace plugin
+
+}  // namespace comms_champion
+
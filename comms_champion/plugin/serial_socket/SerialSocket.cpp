@@ -56,6 +56,12 @@ SerialSocket::SerialSocket()
     connect(
         &m_serial, SIGNAL(readyRead()),
         this, SLOT(performRead()));
+
+    m_holdTimer.setSingleShot(true);
+    m_holdTimer.setTimerType(Qt::PreciseTimer);
+    connect(
+        &m_holdTimer, SIGNAL(timeout()),
+        this, SLOT(holdTimeout()));
 }
 
 SerialSocket::~SerialSocket() = default;
@@ -81,9 +87,14 @@ bool SerialSocket::socketConnectImpl()
 
 void SerialSocket::socketDisconnectImpl()
 {
+    m_holdTimer.stop();
     if (!m_serial.isOpen()) {
         return;
     }
+
+    if (0 < m_serial.bytesAvailable()) {
+        reportAvailable();
+    }
     m_serial.flush();
     m_serial.close();
 }
@@ -96,12 +107,45 @@ void SerialSocket::sendDataImpl(DataInfoPtr dataPtr)
         dataPtr->m_data.size());
 }
 
+std::size_t SerialSocket::pendingSendBytesImpl() const
+{
+    return static_cast<std::size_t>(m_serial.bytesToWrite());
+}
+
 void SerialSocket::performRead()
 {
     assert(sender() == &m_serial);
 
+    if ((m_holdTime == 0U) ||
+        (static_cast<qint64>(m_minChunk) <= m_serial.bytesAvailable())) {
+        m_holdTimer.stop();
+        reportAvailable();
+        return;
+    }
+
+    // Keep received bytes in the port's buffer until more arrive
+    if (!m_holdTimer.isActive()) {
+        m_holdTimestamp = DataInfo::TimestampClock::now();
+        m_holdTimer.start(static_cast<int>(m_holdTime));
+    }
+}
+
+void SerialSocket::holdTimeout()
+{
+    if (0 < m_serial.bytesAvailable()) {
+        reportAvailable();
+    }
+}
+
+void SerialSocket::reportAvailable()
+{
     auto dataPtr = makeDataInfo();
     dataPtr->m_timestamp = DataInfo::TimestampClock::now();
+    if (m_holdTimestamp != DataInfo::Timestamp()) {
+        // Report arrival time of the first held byte
+        dataPtr->m_timestamp = m_holdTimestamp;
+        m_holdTimestamp = DataInfo::Timestamp();
+    }
 
     auto dataSize = m_serial.bytesAvailable();
     dataPtr->m_data.resize(dataSize);
@@ -24,6 +24,7 @@
 CC_DISABLE_WARNINGS()
 #include <QtSerialPort/QSerialPort>
 #include <QtCore/QString>
+#include <QtCore/QTimer>
 CC_ENABLE_WARNINGS()
 
 #include "comms_champion/Socket.h"
@@ -51,6 +52,8 @@ public:
     typedef QSerialPort::Parity Parity;
     typedef QSerialPort::StopBits StopBits;
     typedef QSerialPort::FlowControl FlowControl;
+    typedef unsigned ChunkSize;
+    typedef unsigned HoldTime;
 
     SerialSocket();
     ~SerialSocket();
@@ -85,23 +88,45 @@ public:
         return m_flowControl;
     }
 
+    // Received bytes are held until at least minChunk() of them are
+    // available (like VMIN) or holdTime() milliseconds passed since the
+    // arrival of the first one (like VTIME). Zero hold time reports every
+    // read immediately.
+    ChunkSize& minChunk()
+    {
+        return m_minChunk;
+    }
+
+    HoldTime& holdTime()
+    {
+        return m_holdTime;
+    }
+
 protected:
     virtual bool socketConnectImpl() override;
     virtual void socketDisconnectImpl() override;
     virtual void sendDataImpl(DataInfoPtr dataPtr) override;
+    virtual std::size_t pendingSendBytesImpl() const override;
 
 private slots:
     void performRead();
+    void holdTimeout();
     void errorOccurred(QSerialPort::SerialPortError err);
 
 private:
+    void reportAvailable();
+
     QSerialPort m_serial;
+    QTimer m_holdTimer;
+    DataInfo::Timestamp m_holdTimestamp;
     QString m_name;
     Baud m_baud = 115200;
     DataBits m_dataBits = DataBits::Data8;
     Parity m_parity = Parity::NoParity;
     StopBits m_stopBits = StopBits::OneStop;
     FlowControl m_flowControl = FlowControl::NoFlowControl;
+    ChunkSize m_minChunk = 1U;
+    HoldTime m_holdTime = 0U;
 };
 
 }  // namespace serial_socket
@@ -121,6 +121,8 @@ SerialSocketConfigWidget::SerialSocketConfigWidget(
     m_ui.m_parityComboBox->setCurrentIndex(mapParityToIdx(m_socket.parity()));
     m_ui.m_stopBitsComboBox->setCurrentIndex(mapStopBitToIdx(m_socket.stopBits()));
     m_ui.m_flowComboBox->setCurrentIndex(mapFlowControlToIdx(m_socket.flowControl()));
+    m_ui.m_minChunkSpinBox->setValue(static_cast<int>(m_socket.minChunk()));
+    m_ui.m_holdTimeSpinBox->setValue(static_cast<int>(m_socket.holdTime()));
 
     connect(
         m_ui.m_deviceLineEdit, SIGNAL(textEdited(const QString&)),
@@ -145,6 +147,14 @@ SerialSocketConfigWidget::SerialSocketConfigWidget(
     connect(
         m_ui.m_flowComboBox, SIGNAL(currentIndexChanged(int)),
         this, SLOT(flowControlChanged(int)));
+
+    connect(
+        m_ui.m_minChunkSpinBox, SIGNAL(valueChanged(int)),
+        this, SLOT(minChunkChanged(int)));
+
+    connect(
+        m_ui.m_holdTimeSpinBox, SIGNAL(valueChanged(int)),
+        this, SLOT(holdTimeChanged(int)));
 }
 
 SerialSocketConfigWidget::~SerialSocketConfigWidget() = default;
@@ -179,6 +189,16 @@ void SerialSocketConfigWidget::flowControlChanged(int value)
     m_socket.flowControl() = mapFlowControlFromIdx(value);
 }
 
+void SerialSocketConfigWidget::minChunkChanged(int value)
+{
+    m_socket.minChunk() = static_cast<SerialSocket::ChunkSize>(value);
+}
+
+void SerialSocketConfigWidget::holdTimeChanged(int value)
+{
+    m_socket.holdTime() = static_cast<SerialSocket::HoldTime>(value);
+}
+
 }  // namespace serial_socket
 
 }  // namespace plugin
@@ -54,6 +54,8 @@ private slots:
     void parityChanged(int value);
     void stopBitsChanged(int value);
     void flowControlChanged(int value);
+    void minChunkChanged(int value);
+    void holdTimeChanged(int value);
 
 private:
     SerialSocket& m_socket;
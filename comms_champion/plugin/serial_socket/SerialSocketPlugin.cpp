@@ -42,6 +42,8 @@ const QString DataBitsSubKey("data_bits");
 const QString ParitySubKey("parity");
 const QString StopBitsSubKey("stop_bits");
 const QString FlowControlSubKey("flow");
+const QString MinChunkSubKey("min_chunk");
+const QString HoldTimeSubKey("hold_time");
 
 }  // namespace
 
@@ -75,6 +77,8 @@ void SerialSocketPlugin::getCurrentConfigImpl(QVariantMap& config)
     subConfig.insert(ParitySubKey, static_cast<int>(m_socket->parity()));
     subConfig.insert(StopBitsSubKey, static_cast<int>(m_socket->stopBits()));
     subConfig.insert(FlowControlSubKey, static_cast<int>(m_socket->flowControl()));
+    subConfig.insert(MinChunkSubKey, m_socket->minChunk());
+    subConfig.insert(HoldTimeSubKey, m_socket->holdTime());
     config.insert(MainConfigKey, QVariant::fromValue(subConfig));
 }
 
@@ -134,6 +138,19 @@ void SerialSocketPlugin::reconfigureImpl(const QVariantMap& config)
             m_socket->flowControl() = flow;
         }
     }
+
+    auto minChunkVar = subConfig.value(MinChunkSubKey);
+    if (minChunkVar.isValid() && minChunkVar.canConvert<unsigned>()) {
+        auto minChunk = minChunkVar.value<unsigned>();
+        if (0U < minChunk) {
+            m_socket->minChunk() = minChunk;
+        }
+    }
+
+    auto holdTimeVar = subConfig.value(HoldTimeSubKey);
+    if (holdTimeVar.isValid() && holdTimeVar.canConvert<unsigned>()) {
+        m_socket->holdTime() = holdTimeVar.value<unsigned>();
+    }
 }
 
 void SerialSocketPlugin::createSocketIfNeeded()
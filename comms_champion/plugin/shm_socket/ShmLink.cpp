@@ -0,0 +1,588 @@
+//
+// Copyright 2017 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#include "ShmLink.h"
+
+#include <cassert>
+#include <cstring>
+#include <cerrno>
+#include <climits>
+#include <atomic>
+#include <chrono>
+#include <algorithm>
+#include <new>
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/file.h>
+#include <sys/syscall.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <unistd.h>
+#include <linux/futex.h>
+
+namespace comms_champion
+{
+
+namespace plugin
+{
+
+namespace shm_socket
+{
+
+namespace
+{
+
+typedef std::atomic<std::uint32_t> FutexWord;
+
+static_assert(sizeof(FutexWord) == sizeof(std::uint32_t), "Unexpected atomic size");
+
+const std::uint64_t Magic = 0x63635f73686d6c6bULL;
+const std::uint32_t Version = 2U;
+const std::size_t CacheLineSize = 64U;
+const std::size_t FrameAlignment = 8U;
+const std::size_t MinCapacity = 4U * 1024U;
+const unsigned MaxOpenAttempts = 10U;
+
+struct FrameHeader
+{
+    std::uint32_t m_size;
+    std::uint32_t m_reserved;
+    std::uint64_t m_timestamp;
+};
+
+const std::size_t FrameHeaderSize = sizeof(FrameHeader);
+
+std::size_t alignUp(std::size_t value, std::size_t alignment)
+{
+    return ((value + alignment - 1U) / alignment) * alignment;
+}
+
+std::size_t frameSizeFor(std::size_t payloadSize)
+{
+    return alignUp(FrameHeaderSize + payloadSize, FrameAlignment);
+}
+
+std::string shmName(const std::string& name)
+{
+    if ((!name.empty()) && (name[0] == '/')) {
+        return name;
+    }
+
+    return '/' + name;
+}
+
+bool isProcessAlive(std::int32_t pid)
+{
+    return (::kill(static_cast<pid_t>(pid), 0) == 0) || (errno == EPERM);
+}
+
+// Checks the name wasn't removed (and possibly re-created) by the last
+// side closing the link while the lock was being acquired.
+bool isNameBoundTo(const std::string& fullName, int fd)
+{
+    auto nameFd = ::shm_open(fullName.c_str(), O_RDWR, 0);
+    if (nameFd < 0) {
+        return false;
+    }
+
+    struct stat nameInfo;
+    struct stat fdInfo;
+    bool result =
+        (::fstat(nameFd, &nameInfo) == 0) &&
+        (::fstat(fd, &fdInfo) == 0) &&
+        (nameInfo.st_dev == fdInfo.st_dev) &&
+        (nameInfo.st_ino == fdInfo.st_ino);
+    ::close(nameFd);
+    return result;
+}
+
+void futexWait(FutexWord& word, std::uint32_t expected, unsigned timeoutMs)
+{
+    timespec timeout;
+    timeout.tv_sec = static_cast<time_t>(timeoutMs / 1000U);
+    timeout.tv_nsec = static_cast<long>((timeoutMs % 1000U) * 1000000U);
+    ::syscall(
+        SYS_futex,
+        reinterpret_cast<std::uint32_t*>(&word),
+        FUTEX_WAIT,
+        expected,
+        &timeout,
+        nullptr,
+        0);
+}
+
+void futexWake(FutexWord& word)
+{
+    ::syscall(
+        SYS_futex,
+        reinterpret_cast<std::uint32_t*>(&word),
+        FUTEX_WAKE,
+        INT_MAX,
+        nullptr,
+        nullptr,
+        0);
+}
+
+void copyToRing(std::uint8_t* ring, std::size_t capacity, std::uint64_t pos, const void* src, std::size_t size)
+{
+    if (size == 0U) {
+        return;
+    }
+
+    auto offset = static_cast<std::size_t>(pos & (capacity - 1U));
+    auto first = std::min(size, capacity - offset);
+    auto* srcBytes = static_cast<const std::uint8_t*>(src);
+    std::memcpy(ring + offset, srcBytes, first);
+    std::memcpy(ring, srcBytes + first, size - first);
+}
+
+void copyFromRing(const std::uint8_t* ring, std::size_t capacity, std::uint64_t pos, void* dest, std::size_t size)
+{
+    if (size == 0U) {
+        return;
+    }
+
+    auto offset = static_cast<std::size_t>(pos & (capacity - 1U));
+    auto first = std::min(size, capacity - offset);
+    auto* destBytes = static_cast<std::uint8_t*>(dest);
+    std::memcpy(destBytes, ring + offset, first);
+    std::memcpy(destBytes + first, ring, size - first);
+}
+
+}  // namespace
+
+// Every line is written by one side only.
+struct ShmLink::Ring
+{
+    // Producer's line
+    alignas(CacheLineSize) std::atomic<std::uint64_t> m_head;
+    FutexWord m_dataSeq;
+    std::atomic<std::uint32_t> m_producerWaiting;
+
+    // Consumer's line
+    alignas(CacheLineSize) std::atomic<std::uint64_t> m_tail;
+    FutexWord m_spaceSeq;
+    std::atomic<std::uint32_t> m_consumerWaiting;
+};
+
+// Accessed while holding the file lock, except for the rings
+struct ShmLink::Header
+{
+    std::atomic<std::uint64_t> m_magic;
+    std::uint32_t m_version;
+    std::uint32_t m_reserved;
+    std::uint64_t m_capacity;
+
+    // PID of the process attached in every role, 0 when free
+    std::int32_t m_pids[Role_NumOfValues];
+
+    // Index is the role of the consumer
+    Ring m_rings[Role_NumOfValues];
+};
+
+const std::size_t ShmLink::DefaultCapacity;
+
+ShmLink::ShmLink() = default;
+
+ShmLink::~ShmLink()
+{
+    close();
+}
+
+bool ShmLink::open(const std::string& name, Role role, std::size_t capacity)
+{
+    close();
+    m_error.clear();
+    if ((role != Role_Plugin) && (role != Role_Peer)) {
+        return fail("Invalid role");
+    }
+
+    if ((capacity < MinCapacity) || ((capacity & (capacity - 1U)) != 0U)) {
+        return fail("Capacity must be a power of two and at least 4KB");
+    }
+
+    // All the bookkeeping in the header is done under the exclusive lock
+    // of the segment. The lock is released automatically when the
+    // process holding it crashes.
+    auto fullName = shmName(name);
+    int fd = -1;
+    for (unsigned attempt = 0U; attempt < MaxOpenAttempts; ++attempt) {
+        fd = ::shm_open(fullName.c_str(), O_RDWR | O_CREAT, 0600);
+        if (fd < 0) {
+            return fail("Failed to open shared memory " + fullName + ": " + std::strerror(errno));
+        }
+
+        if (::flock(fd, LOCK_EX) != 0) {
+            ::close(fd);
+            return fail("Failed to lock shared memory " + fullName + ": " + std::strerror(errno));
+        }
+
+        if (isNameBoundTo(fullName, fd)) {
+            break;
+        }
+
+        ::close(fd);
+        fd = -1;
+    }
+
+    if (fd < 0) {
+        return fail("Shared memory " + fullName + " keeps being removed");
+    }
+
+    auto dataOffset = alignUp(sizeof(Header), CacheLineSize);
+    Header* header = nullptr;
+    bool inUse = false;
+    struct stat info;
+    if ((::fstat(fd, &info) == 0) &&
+        (dataOffset <= static_cast<std::size_t>(info.st_size))) {
+        m_memSize = static_cast<std::size_t>(info.st_size);
+        m_mem = ::mmap(nullptr, m_memSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        if (m_mem == MAP_FAILED) {
+            m_mem = nullptr;
+            ::close(fd);
+            return fail("Failed to map shared memory " + fullName);
+        }
+
+        header = static_cast<Header*>(m_mem);
+        if (header->m_magic.load(std::memory_order_acquire) == Magic) {
+            // Forget the processes that crashed without closing the link
+            for (auto& pid : header->m_pids) {
+                if ((pid != 0) && (!isProcessAlive(pid))) {
+                    pid = 0;
+                }
+                inUse = inUse || (pid != 0);
+            }
+        }
+    }
+
+    if (inUse) {
+        capacity = static_cast<std::size_t>(header->m_capacity);
+        if ((header->m_version != Version) ||
+            (capacity < MinCapacity) ||
+            ((capacity & (capacity - 1U)) != 0U) ||
+            (m_memSize < (dataOffset + (capacity * Role_NumOfValues)))) {
+            ::munmap(m_mem, m_memSize);
+            m_mem = nullptr;
+            ::close(fd);
+            return fail("Incompatible shared memory " + fullName);
+        }
+
+        auto rolePid = header->m_pids[role];
+        if (rolePid != 0) {
+            ::munmap(m_mem, m_memSize);
+            m_mem = nullptr;
+            ::close(fd);
+            return fail(
+                "Role in shared memory " + fullName + " is already taken by process " +
+                std::to_string(rolePid));
+        }
+    }
+    else {
+        // Either new segment, or left behind by crashed (or not fully
+        // initialised by crashed) creator, start from scratch.
+        if (m_mem != nullptr) {
+            ::munmap(m_mem, m_memSize);
+            m_mem = nullptr;
+        }
+
+        m_memSize = dataOffset + (capacity * Role_NumOfValues);
+        if (::ftruncate(fd, static_cast<off_t>(m_memSize)) != 0) {
+            ::close(fd);
+            return fail("Failed to resize shared memory " + fullName);
+        }
+
+        m_mem = ::mmap(nullptr, m_memSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        if (m_mem == MAP_FAILED) {
+            m_mem = nullptr;
+            ::close(fd);
+            return fail("Failed to map shared memory " + fullName);
+        }
+
+        header = new (m_mem) Header;
+        header->m_magic.store(0U, std::memory_order_relaxed);
+        header->m_version = Version;
+        header->m_reserved = 0U;
+        header->m_capacity = capacity;
+        for (auto& pid : header->m_pids) {
+            pid = 0;
+        }
+
+        for (auto& ring : header->m_rings) {
+            new (&ring) Ring;
+            ring.m_head.store(0U, std::memory_order_relaxed);
+            ring.m_dataSeq.store(0U, std::memory_order_relaxed);
+            ring.m_producerWaiting.store(0U, std::memory_order_relaxed);
+            ring.m_tail.store(0U, std::memory_order_relaxed);
+            ring.m_spaceSeq.store(0U, std::memory_order_relaxed);
+            ring.m_consumerWaiting.store(0U, std::memory_order_relaxed);
+        }
+
+        header->m_magic.store(Magic, std::memory_order_release);
+    }
+
+    header->m_pids[role] = static_cast<std::int32_t>(::getpid());
+    ::flock(fd, LOCK_UN);
+
+    auto otherRole = (role == Role_Plugin) ? Role_Peer : Role_Plugin;
+    auto* data = static_cast<std::uint8_t*>(m_mem) + dataOffset;
+    m_capacity = capacity;
+    m_rx = &header->m_rings[role];
+    m_tx = &header->m_rings[otherRole];
+    m_rxData = data + (capacity * static_cast<std::size_t>(role));
+    m_txData = data + (capacity * static_cast<std::size_t>(otherRole));
+    m_rxHeadCache = m_rx->m_tail.load(std::memory_order_relaxed);
+    m_txTailCache = m_tx->m_tail.load(std::memory_order_acquire);
+    m_name = fullName;
+    m_fd = fd;
+    m_role = role;
+    return true;
+}
+
+void ShmLink::close()
+{
+    if (m_mem == nullptr) {
+        return;
+    }
+
+    // The last side to close removes the name, the other one may
+    // reconnect to the same segment in the meantime.
+    ::flock(m_fd, LOCK_EX);
+    auto* header = static_cast<Header*>(m_mem);
+    if (header->m_pids[m_role] == static_cast<std::int32_t>(::getpid())) {
+        header->m_pids[m_role] = 0;
+    }
+
+    bool inUse = false;
+    for (auto pid : header->m_pids) {
+        inUse = inUse || ((pid != 0) && isProcessAlive(pid));
+    }
+
+    if ((!inUse) && isNameBoundTo(m_name, m_fd)) {
+        ::shm_unlink(m_name.c_str());
+    }
+
+    ::munmap(m_mem, m_memSize);
+    ::close(m_fd);
+
+    m_mem = nullptr;
+    m_memSize = 0U;
+    m_capacity = 0U;
+    m_rx = nullptr;
+    m_tx = nullptr;
+    m_rxData = nullptr;
+    m_txData = nullptr;
+    m_rxHeadCache = 0U;
+    m_txTailCache = 0U;
+    m_name.clear();
+    m_fd = -1;
+    m_role = Role_NumOfValues;
+}
+
+bool ShmLink::isOpen() const
+{
+    return m_mem != nullptr;
+}
+
+const std::string& ShmLink::errorString() const
+{
+    return m_error;
+}
+
+std::size_t ShmLink::capacity() const
+{
+    return m_capacity;
+}
+
+std::size_t ShmLink::maxFrameSize() const
+{
+    if (m_capacity == 0U) {
+        return 0U;
+    }
+
+    return m_capacity - FrameHeaderSize;
+}
+
+bool ShmLink::write(const void* data, std::size_t size, Timestamp timestamp)
+{
+    if (m_tx == nullptr) {
+        return false;
+    }
+
+    auto frameSize = frameSizeFor(size);
+    if ((m_capacity < frameSize) || (!hasSpace(frameSize))) {
+        return false;
+    }
+
+    FrameHeader header;
+    header.m_size = static_cast<std::uint32_t>(size);
+    header.m_reserved = 0U;
+    header.m_timestamp = (timestamp != 0U) ? timestamp : now();
+
+    auto head = m_tx->m_head.load(std::memory_order_relaxed);
+    copyToRing(m_txData, m_capacity, head, &header, FrameHeaderSize);
+    copyToRing(m_txData, m_capacity, head + FrameHeaderSize, data, size);
+    m_tx->m_head.store(head + frameSize, std::memory_order_release);
+
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (m_tx->m_consumerWaiting.load(std::memory_order_relaxed) != 0U) {
+        m_tx->m_dataSeq.fetch_add(1U, std::memory_order_release);
+        futexWake(m_tx->m_dataSeq);
+    }
+    return true;
+}
+
+bool ShmLink::writeWait(const void* data, std::size_t size, Timestamp timestamp, unsigned timeoutMs)
+{
+    if (m_tx == nullptr) {
+        return false;
+    }
+
+    auto frameSize = frameSizeFor(size);
+    if (m_capacity < frameSize) {
+        return false;
+    }
+
+    auto deadline =
+        std::chrono::steady_clock::now() + std::chrono::milliseconds(timeoutMs);
+    while (!write(data, size, timestamp)) {
+        auto now = std::chrono::steady_clock::now();
+        if (deadline <= now) {
+            return false;
+        }
+
+        m_tx->m_producerWaiting.store(1U, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        auto seq = m_tx->m_spaceSeq.load(std::memory_order_acquire);
+        if (!hasSpace(frameSize)) {
+            auto remMs =
+                std::chrono::duration_cast<std::chrono::milliseconds>(deadline - now).count();
+            futexWait(m_tx->m_spaceSeq, seq, static_cast<unsigned>(std::max(remMs, decltype(remMs)(1))));
+        }
+        m_tx->m_producerWaiting.store(0U, std::memory_order_relaxed);
+    }
+    return true;
+}
+
+bool ShmLink::read(std::vector<std::uint8_t>& data, Timestamp& timestamp)
+{
+    if ((m_rx == nullptr) || (!hasData())) {
+        return false;
+    }
+
+    auto tail = m_rx->m_tail.load(std::memory_order_relaxed);
+    FrameHeader header;
+    copyFromRing(m_rxData, m_capacity, tail, &header, FrameHeaderSize);
+    auto frameSize = frameSizeFor(header.m_size);
+    if ((m_capacity < frameSize) || ((m_rxHeadCache - tail) < frameSize)) {
+        // Drop everything written so far
+        m_rx->m_tail.store(m_rxHeadCache, std::memory_order_release);
+        fail("Corrupted frame in shared memory " + m_name);
+        return false;
+    }
+
+    data.resize(header.m_size);
+    copyFromRing(m_rxData, m_capacity, tail + FrameHeaderSize, data.data(), header.m_size);
+    timestamp = header.m_timestamp;
+    m_rx->m_tail.store(tail + frameSize, std::memory_order_release);
+
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (m_rx->m_producerWaiting.load(std::memory_order_relaxed) != 0U) {
+        m_rx->m_spaceSeq.fetch_add(1U, std::memory_order_release);
+        futexWake(m_rx->m_spaceSeq);
+    }
+    return true;
+}
+
+bool ShmLink::waitReadable(unsigned timeoutMs)
+{
+    if (m_rx == nullptr) {
+        return false;
+    }
+
+    if (hasData()) {
+        return true;
+    }
+
+    m_rx->m_consumerWaiting.store(1U, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    auto seq = m_rx->m_dataSeq.load(std::memory_order_acquire);
+    if (!hasData()) {
+        futexWait(m_rx->m_dataSeq, seq, timeoutMs);
+    }
+    m_rx->m_consumerWaiting.store(0U, std::memory_order_relaxed);
+    return hasData();
+}
+
+std::size_t ShmLink::pendingWriteBytes() const
+{
+    if (m_tx == nullptr) {
+        return 0U;
+    }
+
+    auto head = m_tx->m_head.load(std::memory_order_relaxed);
+    auto tail = m_tx->m_tail.load(std::memory_order_relaxed);
+    return static_cast<std::size_t>(head - tail);
+}
+
+ShmLink::Timestamp ShmLink::now()
+{
+    return
+        static_cast<Timestamp>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::high_resolution_clock::now().time_since_epoch()).count());
+}
+
+bool ShmLink::remove(const std::string& name)
+{
+    return ::shm_unlink(shmName(name).c_str()) == 0;
+}
+
+bool ShmLink::hasSpace(std::size_t frameSize)
+{
+    auto head = m_tx->m_head.load(std::memory_order_relaxed);
+    if (frameSize <= (m_capacity - static_cast<std::size_t>(head - m_txTailCache))) {
+        return true;
+    }
+
+    m_txTailCache = m_tx->m_tail.load(std::memory_order_acquire);
+    return frameSize <= (m_capacity - static_cast<std::size_t>(head - m_txTailCache));
+}
+
+bool ShmLink::hasData()
+{
+    auto tail = m_rx->m_tail.load(std::memory_order_relaxed);
+    if (tail != m_rxHeadCache) {
+        return true;
+    }
+
+    m_rxHeadCache = m_rx->m_head.load(std::memory_order_acquire);
+    return tail != m_rxHeadCache;
+}
+
+bool ShmLink::fail(const std::string& msg)
+{
+    m_error = msg;
+    return false;
+}
+
+}  // namespace shm_socket
+
+}  // namespace plugin
+
+}  // namespace comms_champion
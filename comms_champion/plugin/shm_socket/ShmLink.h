@@ -0,0 +1,148 @@
+//
+// Copyright 2017 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace comms_champion
+{
+
+namespace plugin
+{
+
+namespace shm_socket
+{
+
+/// @brief Pair of single producer / single consumer rings in named
+///     POSIX shared memory.
+/// @details Used by the shared memory socket plugin and by the peer
+///     applications (simulators) it talks to. Doesn't depend on Qt nor
+///     on the rest of the CommsChampion library. The data is exchanged
+///     as frames carrying the timestamp of their creation. The sleeping
+///     consumer (or producer waiting for free space) is woken up using
+///     futex on a word in the shared segment. The first side to open
+///     the link creates the segment, the other one attaches to it. The
+///     segment records which process is attached in every role, every role
+///     can be taken by a single process only. The segment left behind by
+///     crashed applications is re-initialised by the next open(), and the
+///     last side to close() the link removes its name.
+/// @headerfile ShmLink.h
+class ShmLink
+{
+public:
+    /// @brief Side of the link, determines direction of the rings.
+    enum Role
+    {
+        Role_Plugin, ///< Side of the CommsChampion socket plugin
+        Role_Peer, ///< Side of the peer application
+        Role_NumOfValues ///< Limit for the values
+    };
+
+    /// @brief Frame timestamp, nanoseconds since epoch of
+    ///     std::chrono::high_resolution_clock.
+    typedef std::uint64_t Timestamp;
+
+    /// @brief Default capacity of every ring in bytes.
+    static const std::size_t DefaultCapacity = 16U * 1024U * 1024U;
+
+    ShmLink();
+    ~ShmLink();
+
+    ShmLink(const ShmLink&) = delete;
+    ShmLink& operator=(const ShmLink&) = delete;
+
+    /// @brief Create or attach to the named segment.
+    /// @details The capacity must be a power of two and is ignored
+    ///     when attaching to the segment used by the other side.
+    ///     Fails when the role is already taken by a running process.
+    bool open(const std::string& name, Role role, std::size_t capacity = DefaultCapacity);
+
+    /// @brief Detach from the segment.
+    void close();
+
+    /// @brief Check whether the link is open.
+    bool isOpen() const;
+
+    /// @brief Description of the last error.
+    const std::string& errorString() const;
+
+    /// @brief Capacity of every ring.
+    std::size_t capacity() const;
+
+    /// @brief Maximal size of the single frame payload.
+    std::size_t maxFrameSize() const;
+
+    /// @brief Write single frame without blocking.
+    /// @details Zero timestamp is replaced with now().
+    /// @return @b false when there is not enough free space.
+    bool write(const void* data, std::size_t size, Timestamp timestamp = 0U);
+
+    /// @brief Write single frame, wait for free space if needed.
+    bool writeWait(const void* data, std::size_t size, Timestamp timestamp, unsigned timeoutMs);
+
+    /// @brief Read single frame without blocking.
+    /// @return @b false when there is nothing to read.
+    bool read(std::vector<std::uint8_t>& data, Timestamp& timestamp);
+
+    /// @brief Wait until there is something to read.
+    bool waitReadable(unsigned timeoutMs);
+
+    /// @brief Number of written bytes not consumed by the other side yet.
+    std::size_t pendingWriteBytes() const;
+
+    /// @brief Current timestamp.
+    static Timestamp now();
+
+    /// @brief Remove the name of the segment.
+    /// @details Not needed for the segments left behind by the crashed
+    ///     applications, they are re-initialised by open(). The sides
+    ///     already attached to the removed segment can still use it.
+    static bool remove(const std::string& name);
+
+private:
+    struct Ring;
+    struct Header;
+
+    bool hasSpace(std::size_t frameSize);
+    bool hasData();
+    bool fail(const std::string& msg);
+
+    void* m_mem = nullptr;
+    std::size_t m_memSize = 0U;
+    std::size_t m_capacity = 0U;
+    Ring* m_rx = nullptr;
+    Ring* m_tx = nullptr;
+    std::uint8_t* m_rxData = nullptr;
+    std::uint8_t* m_txData = nullptr;
+    std::uint64_t m_rxHeadCache = 0U;
+    std::uint64_t m_txTailCache = 0U;
+    std::string m_name;
+    std::string m_error;
+    int m_fd = -1;
+    Role m_role = Role_NumOfValues;
+};
+
+}  // namespace shm_socket
+
+}  // namespace plugin
+
+}  // namespace comms_champion
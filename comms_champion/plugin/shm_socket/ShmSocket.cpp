@@ -0,0 +1,242 @@
+//
+// Copyright 2017 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#include "ShmSocket.h"
+
+#include <cassert>
+#include <chrono>
+#include <vector>
+
+#include "comms/CompileControl.h"
+
+CC_DISABLE_WARNINGS()
+#include <QtCore/QMetaObject>
+CC_ENABLE_WARNINGS()
+
+namespace comms_champion
+{
+
+namespace plugin
+{
+
+namespace shm_socket
+{
+
+namespace
+{
+
+const QString DefaultName("cc_shm");
+const std::size_t MegaByte = 1024U * 1024U;
+const unsigned WaitTimeoutMs = 100U;
+
+// Amount of data read from the ring before handing it to the main thread
+const std::size_t MaxBatchBytes = 4U * MegaByte;
+
+// The reading thread stops consuming the ring (slowing down the peer)
+// while this amount of received data waits to be reported.
+const std::size_t MaxReceivedBytes = 64U * MegaByte;
+
+std::size_t ringCapacity(unsigned megabytes)
+{
+    std::size_t result = MegaByte;
+    while ((result / MegaByte) < megabytes) {
+        result <<= 1;
+    }
+    return result;
+}
+
+DataInfo::Timestamp toTimestamp(ShmLink::Timestamp value)
+{
+    return
+        DataInfo::Timestamp(
+            std::chrono::duration_cast<DataInfo::TimestampClock::duration>(
+                std::chrono::nanoseconds(value)));
+}
+
+ShmLink::Timestamp fromTimestamp(const DataInfo::Timestamp& value)
+{
+    return
+        static_cast<ShmLink::Timestamp>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(
+                value.time_since_epoch()).count());
+}
+
+}  // namespace
+
+ShmSocket::ShmSocket()
+  : m_name(DefaultName),
+    m_reading(false)
+{
+}
+
+ShmSocket::~ShmSocket()
+{
+    stopReading();
+}
+
+bool ShmSocket::socketConnectImpl()
+{
+    if (m_link.isOpen()) {
+        // Reopening would unmap the rings while the read thread uses them
+        static const QString AlreadyConnectedError(
+            tr("Shared memory link is already connected."));
+        reportError(AlreadyConnectedError);
+        return false;
+    }
+
+    if (m_name.isEmpty()) {
+        static const QString NoNameError(
+            tr("Name of the shared memory link wasn't provided."));
+        reportError(NoNameError);
+        return false;
+    }
+
+    if (!m_link.open(m_name.toStdString(), ShmLink::Role_Plugin, ringCapacity(m_capacity))) {
+        reportError(
+            tr("Failed to open shared memory link: ") +
+            QString::fromStdString(m_link.errorString()));
+        return false;
+    }
+
+    m_sendOverflow = false;
+    m_reading = true;
+    m_readThread = std::thread(&ShmSocket::readLoop, this);
+    return true;
+}
+
+void ShmSocket::socketDisconnectImpl()
+{
+    stopReading();
+    m_link.close();
+
+    std::lock_guard<std::mutex> guard(m_receivedLock);
+    m_received.clear();
+    m_receivedBytes = 0U;
+}
+
+void ShmSocket::sendDataImpl(DataInfoPtr dataPtr)
+{
+    assert(dataPtr);
+    if (!m_link.isOpen()) {
+        return;
+    }
+
+    auto written =
+        m_link.write(
+            dataPtr->m_data.data(),
+            dataPtr->m_data.size(),
+            fromTimestamp(dataPtr->m_timestamp));
+
+    if (written) {
+        m_sendOverflow = false;
+        return;
+    }
+
+    if (m_sendOverflow) {
+        return;
+    }
+
+    m_sendOverflow = true;
+    static const QString OverflowError(
+        tr("Shared memory peer doesn't consume the data, some of it is dropped."));
+    reportError(OverflowError);
+}
+
+std::size_t ShmSocket::pendingSendBytesImpl() const
+{
+    return m_link.pendingWriteBytes();
+}
+
+void ShmSocket::reportReceived()
+{
+    DataInfosList received;
+    {
+        std::lock_guard<std::mutex> guard(m_receivedLock);
+        received.swap(m_received);
+        m_receivedBytes = 0U;
+    }
+
+    for (auto& dataPtr : received) {
+        reportDataReceived(std::move(dataPtr));
+    }
+}
+
+void ShmSocket::readLoop()
+{
+    std::vector<std::uint8_t> data;
+    while (m_reading) {
+        if (!m_link.waitReadable(WaitTimeoutMs)) {
+            continue;
+        }
+
+        DataInfosList batch;
+        std::size_t batchBytes = 0U;
+        ShmLink::Timestamp timestamp = 0U;
+        while ((batchBytes < MaxBatchBytes) && m_link.read(data, timestamp)) {
+            auto dataPtr = makeDataInfo();
+            dataPtr->m_timestamp = toTimestamp(timestamp);
+            dataPtr->m_data.swap(data);
+            batchBytes += dataPtr->m_data.size();
+            batch.push_back(std::move(dataPtr));
+        }
+
+        if (batch.empty()) {
+            continue;
+        }
+
+        bool notify = false;
+        {
+            std::lock_guard<std::mutex> guard(m_receivedLock);
+            notify = m_received.empty();
+            m_receivedBytes += batchBytes;
+            m_received.splice(m_received.end(), batch);
+        }
+
+        if (notify) {
+            QMetaObject::invokeMethod(this, "reportReceived", Qt::QueuedConnection);
+        }
+
+        while (m_reading) {
+            bool belowLimit = false;
+            {
+                std::lock_guard<std::mutex> guard(m_receivedLock);
+                belowLimit = (m_receivedBytes < MaxReceivedBytes);
+            }
+
+            if (belowLimit) {
+                break;
+            }
+
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+}
+
+void ShmSocket::stopReading()
+{
+    m_reading = false;
+    if (m_readThread.joinable()) {
+        m_readThread.join();
+    }
+}
+
+}  // namespace shm_socket
+
+} // namespace plugin
+
+} // namespace comms_champion
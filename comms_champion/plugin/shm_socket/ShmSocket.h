@@ -0,0 +1,100 @@
+//
+// Copyright 2017 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <list>
+
+#include "comms/CompileControl.h"
+
+CC_DISABLE_WARNINGS()
+#include <QtCore/QObject>
+#include <QtCore/QString>
+CC_ENABLE_WARNINGS()
+
+#include "comms_champion/Socket.h"
+
+#include "ShmLink.h"
+
+namespace comms_champion
+{
+
+namespace plugin
+{
+
+namespace shm_socket
+{
+
+class ShmSocket : public QObject,
+                  public comms_champion::Socket
+{
+    Q_OBJECT
+    using Base = comms_champion::Socket;
+
+public:
+    ShmSocket();
+    ~ShmSocket();
+
+    QString& name()
+    {
+        return m_name;
+    }
+
+    // Capacity of every ring in megabytes
+    unsigned& capacity()
+    {
+        return m_capacity;
+    }
+
+protected:
+    virtual bool socketConnectImpl() override;
+    virtual void socketDisconnectImpl() override;
+    virtual void sendDataImpl(DataInfoPtr dataPtr) override;
+    virtual std::size_t pendingSendBytesImpl() const override;
+
+private slots:
+    void reportReceived();
+
+private:
+    typedef std::list<DataInfoPtr> DataInfosList;
+
+    void readLoop();
+    void stopReading();
+
+    ShmLink m_link;
+    QString m_name;
+    unsigned m_capacity = 16U;
+
+    std::thread m_readThread;
+    std::atomic<bool> m_reading;
+    std::mutex m_receivedLock;
+    DataInfosList m_received;
+    std::size_t m_receivedBytes = 0U;
+    bool m_sendOverflow = false;
+};
+
+}  // namespace shm_socket
+
+} // namespace plugin
+
+} // namespace comms_champion
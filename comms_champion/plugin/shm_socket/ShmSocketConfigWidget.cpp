@@ -0,0 +1,67 @@
+//
+// Copyright 2017 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#include "ShmSocketConfigWidget.h"
+
+namespace comms_champion
+{
+
+namespace plugin
+{
+
+namespace shm_socket
+{
+
+ShmSocketConfigWidget::ShmSocketConfigWidget(
+    ShmSocket& socket,
+    QWidget* parentObj)
+  : Base(parentObj),
+    m_socket(socket)
+{
+    m_ui.setupUi(this);
+    m_ui.m_nameLineEdit->setText(m_socket.name());
+    m_ui.m_capacitySpinBox->setValue(static_cast<int>(m_socket.capacity()));
+
+    connect(
+        m_ui.m_nameLineEdit, SIGNAL(textEdited(const QString&)),
+        this, SLOT(nameChanged(const QString&)));
+
+    connect(
+        m_ui.m_capacitySpinBox, SIGNAL(valueChanged(int)),
+        this, SLOT(capacityChanged(int)));
+}
+
+ShmSocketConfigWidget::~ShmSocketConfigWidget() = default;
+
+void ShmSocketConfigWidget::nameChanged(const QString& value)
+{
+    m_socket.name() = value;
+}
+
+void ShmSocketConfigWidget::capacityChanged(int value)
+{
+    m_socket.capacity() = static_cast<unsigned>(value);
+}
+
+}  // namespace shm_socket
+
+}  // namespace plugin
+
+}  // namespace comms_champion
+
+
@@ -115,6 +115,11 @@ void Socket::sendDataImpl(DataInfoPtr dataPtr)
 
 }
 
+std::size_t Socket::pendingSendBytesImpl() const
+{
+    return static_cast<std::size_t>(m_socket.bytesToWrite());
+}
+
 void Socket::socketDisconnected()
 {
 //    static const QString DisconnectedError(
@@ -77,6 +77,7 @@ protected:
     virtual bool socketConnectImpl() override;
     virtual void socketDisconnectImpl() override;
     virtual void sendDataImpl(DataInfoPtr dataPtr) override;
+    virtual std::size_t pendingSendBytesImpl() const override;
 
 private slots:
     void socketDisconnected();
@@ -16,6 +16,8 @@
 // along with this program.  If not, see <http://www.gnu.org/licenses/>.
 
 #include <cassert>
+#include <algorithm>
+#include <cstdint>
 
 #include "comms/CompileControl.h"
 
@@ -42,11 +44,49 @@ namespace
 
 const QString FromPropName("tcp.from");
 const QString ToPropName("tcp.to");
+const QString ForwardedPropName("tcp.forwarded");
+const QString DroppedPropName("tcp.dropped");
+const char* StreamKeyPropName = "cc.stream_key";
+const char* EndpointPropName = "cc.endpoint";
+const char* GapPropName = "cc.gap";
+
+// Forwarded data waiting to be decoded is limited to this size,
+// the rest is forwarded without being decoded.
+const std::size_t MaxPendingBytes = 8U * 1024U * 1024U;
+
+// Amount of pending data reported in one event loop iteration
+const std::size_t MaxReportBytesPerRun = 256U * 1024U;
+
+// Consecutive chunks of the same stream are merged up to this size
+const std::size_t MaxMergedBytes = 64U * 1024U;
+
+QString endpointStr(const QTcpSocket& socket)
+{
+    return socket.peerAddress().toString() + ':' +
+                QString("%1").arg(socket.peerPort());
+}
+
+// Endpoint strings are calculated once per connection
+void cacheEndpoint(QTcpSocket& socket)
+{
+    socket.setProperty(EndpointPropName, endpointStr(socket));
+}
+
+QString cachedEndpoint(const QTcpSocket& socket)
+{
+    return socket.property(EndpointPropName).toString();
+}
 
 }  // namespace
 
 Socket::Socket()
 {
+    m_reportTimer.setSingleShot(true);
+    m_reportTimer.setInterval(0);
+    QObject::connect(
+        &m_reportTimer, SIGNAL(timeout()),
+        this, SLOT(reportPending()));
+
     QObject::connect(
         &m_server, SIGNAL(newConnection()),
         this, SLOT(newConnection()));
@@ -103,6 +143,10 @@ bool Socket::socketConnectImpl()
 void Socket::socketDisconnectImpl()
 {
     m_server.close();
+    m_reportTimer.stop();
+    m_pending.clear();
+    m_pendingBytes = 0U;
+    m_pendingOverflow = false;
 }
 
 void Socket::sendDataImpl(DataInfoPtr dataPtr)
@@ -119,13 +163,8 @@ void Socket::sendDataImpl(DataInfoPtr dataPtr)
             reinterpret_cast<const char*>(&dataPtr->m_data[0]),
             dataPtr->m_data.size());
 
-        toList.append(
-            connectedPair.first->peerAddress().toString() + ':' +
-                        QString("%1").arg(connectedPair.first->peerPort()));
-
-        toList.append(
-            connectedPair.second->peerAddress().toString() + ':' +
-                        QString("%1").arg(connectedPair.second->peerPort()));
+        toList.append(cachedEndpoint(*connectedPair.first));
+        toList.append(cachedEndpoint(*connectedPair.second));
     }
     QString from =
         m_server.serverAddress().toString() + ':' +
@@ -168,6 +207,11 @@ void Socket::newConnection()
         m_remoteHost = QHostAddress(QHostAddress::LocalHost).toString();
     }
 
+    // Every direction is a separate stream, decoded independently.
+    assignStreamKey(*newConnSocket);
+    assignStreamKey(*connectionSocket);
+    cacheEndpoint(*newConnSocket);
+
     connectionSocket->connectToHost(m_remoteHost, m_remotePort);
     m_sockets.emplace_back(newConnSocket, std::move(connectionSocket));
 }
@@ -203,7 +247,7 @@ void Socket::readFromClientSocket()
     assert(iter->second);
     auto& connectionSocket = *(iter->second);
 
-    performReadWrite(*socket, connectionSocket);
+    performReadWrite(*socket, connectionSocket, Direction_ClientToRemote);
 }
 
 void Socket::socketErrorOccurred(QAbstractSocket::SocketError err)
@@ -240,6 +284,7 @@ void Socket::connectionSocketConnected()
     auto iter = findByConnection(socket);
     assert(iter != m_sockets.end());
     assert(iter->first != nullptr);
+    cacheEndpoint(*socket);
 
     connect(
         iter->first, SIGNAL(readyRead()),
@@ -247,7 +292,7 @@ void Socket::connectionSocketConnected()
 
     if (0 < iter->first->bytesAvailable()) {
         assert(iter->second);
-        performReadWrite(*iter->first, *iter->second);
+        performReadWrite(*iter->first, *iter->second, Direction_ClientToRemote);
     }
 }
 
@@ -284,7 +329,53 @@ void Socket::readFromConnectionSocket()
     assert (iter != m_sockets.end());
     assert(iter->first != nullptr);
     auto& clientSocket = *(iter->first);
-    performReadWrite(*socket, clientSocket);
+    performReadWrite(*socket, clientSocket, Direction_RemoteToClient);
+}
+
+void Socket::reportPending()
+{
+    std::size_t reportedBytes = 0U;
+    while ((!m_pending.empty()) && (reportedBytes < MaxReportBytesPerRun)) {
+        auto& first = m_pending.front();
+        auto dir = first.m_dir;
+        auto streamKey = first.m_streamKey;
+
+        auto dataPtr = makeDataInfo();
+        dataPtr->m_timestamp = first.m_timestamp;
+        dataPtr->m_streamKey = streamKey;
+        dataPtr->m_extraProperties.insert(FromPropName, first.m_from);
+        dataPtr->m_extraProperties.insert(ToPropName, first.m_to);
+        dataPtr->m_extraProperties.insert(ForwardedPropName, m_forwardedBytes[dir]);
+        if (m_droppedBytes[dir] != 0U) {
+            dataPtr->m_extraProperties.insert(DroppedPropName, m_droppedBytes[dir]);
+        }
+
+        assert(first.m_data.size() <= m_pendingBytes);
+        m_pendingBytes -= first.m_data.size();
+        dataPtr->m_data = std::move(first.m_data);
+        m_pending.pop_front();
+
+        // Consecutive chunks of the same stream are decoded together
+        while ((!m_pending.empty()) &&
+               (m_pending.front().m_streamKey == streamKey) &&
+               (dataPtr->m_data.size() < MaxMergedBytes)) {
+            auto& chunk = m_pending.front();
+            dataPtr->m_data.insert(dataPtr->m_data.end(), chunk.m_data.begin(), chunk.m_data.end());
+            assert(chunk.m_data.size() <= m_pendingBytes);
+            m_pendingBytes -= chunk.m_data.size();
+            m_pending.pop_front();
+        }
+
+        reportedBytes += dataPtr->m_data.size();
+        reportDataReceived(std::move(dataPtr));
+    }
+
+    if (m_pending.empty()) {
+        m_pendingOverflow = false;
+        return;
+    }
+
+    m_reportTimer.start();
 }
 
 Socket::SocketsList::iterator Socket::findByClient(QTcpSocket* socket)
@@ -335,39 +426,77 @@ void Socket::removeConnection(SocketsList::iterator iter)
     }
 }
 
-void Socket::performReadWrite(QTcpSocket& readFromSocket, QTcpSocket& writeToSocket)
+void Socket::assignStreamKey(QTcpSocket& socket)
+{
+    socket.setProperty(
+        StreamKeyPropName,
+        QVariant::fromValue<qulonglong>(m_nextStreamKey));
+    ++m_nextStreamKey;
+}
+
+void Socket::performReadWrite(
+    QTcpSocket& readFromSocket,
+    QTcpSocket& writeToSocket,
+    Direction dir)
 {
-    if (readFromSocket.bytesAvailable() == 0) {
+    auto available = readFromSocket.bytesAvailable();
+    if (available <= 0) {
         return;
     }
 
-    auto dataPtr = makeDataInfo();
-    dataPtr->m_timestamp = DataInfo::TimestampClock::now();
+    auto timestamp = DataInfo::TimestampClock::now();
 
-    auto dataSize = readFromSocket.bytesAvailable();
-    dataPtr->m_data.resize(dataSize);
-    auto result =
-        readFromSocket.read(reinterpret_cast<char*>(&dataPtr->m_data[0]), dataSize);
-    if (result != dataSize) {
-        dataPtr->m_data.resize(result);
+    // Read directly into the buffer passed to the decoding later
+    DataInfo::DataSeq data(static_cast<std::size_t>(available));
+    auto readCount =
+        readFromSocket.read(
+            reinterpret_cast<char*>(&data[0]),
+            static_cast<qint64>(data.size()));
+    if (readCount <= 0) {
+        return;
     }
 
-    writeToSocket.write(
-        reinterpret_cast<const char*>(&dataPtr->m_data[0]),
-        dataPtr->m_data.size());
-
-    QString from =
-        readFromSocket.peerAddress().toString() + ':' +
-                    QString("%1").arg(readFromSocket.peerPort());
-    QString to =
-        writeToSocket.peerAddress().toString() + ':' +
-                    QString("%1").arg(writeToSocket.peerPort());
-
+    auto dataSize = static_cast<std::size_t>(readCount);
+    data.resize(dataSize);
+
+    // Forward first, the decoding is deferred to the next event loop
+    // iteration.
+    writeToSocket.write(reinterpret_cast<const char*>(&data[0]), readCount);
+    writeToSocket.flush();
+    m_forwardedBytes[dir] += dataSize;
+
+    if (MaxPendingBytes < (m_pendingBytes + dataSize)) {
+        m_droppedBytes[dir] += dataSize;
+        readFromSocket.setProperty(GapPropName, true);
+        if (!m_pendingOverflow) {
+            m_pendingOverflow = true;
+            static const QString OverflowError(
+                tr("Decoding doesn't keep up with the proxied data, some of it won't be displayed."));
+            reportError(OverflowError);
+        }
+        return;
+    }
 
-    dataPtr->m_extraProperties.insert(FromPropName, from);
-    dataPtr->m_extraProperties.insert(ToPropName, to);
+    if (readFromSocket.property(GapPropName).toBool()) {
+        // The data after the gap is decoded as a new stream, the
+        // decoder of the old one would try to continue the cut frame.
+        readFromSocket.setProperty(GapPropName, false);
+        assignStreamKey(readFromSocket);
+    }
 
-    reportDataReceived(std::move(dataPtr));
+    PendingChunk chunk;
+    chunk.m_data = std::move(data);
+    chunk.m_timestamp = timestamp;
+    chunk.m_streamKey = readFromSocket.property(StreamKeyPropName).toULongLong();
+    chunk.m_dir = dir;
+    chunk.m_from = cachedEndpoint(readFromSocket);
+    chunk.m_to = cachedEndpoint(writeToSocket);
+
+    m_pendingBytes += dataSize;
+    m_pending.push_back(std::move(chunk));
+    if (!m_reportTimer.isActive()) {
+        m_reportTimer.start();
+    }
 }
 
 }  // namespace proxy
@@ -18,12 +18,16 @@
 #pragma once
 
 #include <list>
+#include <deque>
+#include <array>
 
 #include "comms/CompileControl.h"
 
 CC_DISABLE_WARNINGS()
 #include <QtNetwork/QTcpServer>
 #include <QtNetwork/QTcpSocket>
+#include <QtCore/QByteArray>
+#include <QtCore/QTimer>
 CC_ENABLE_WARNINGS()
 
 #include "comms_champion/Socket.h"
@@ -83,6 +87,26 @@ public:
         return m_remotePort;
     }
 
+    enum Direction
+    {
+        Direction_ClientToRemote,
+        Direction_RemoteToClient,
+        Direction_NumOfValues
+    };
+
+    // Total number of bytes forwarded in the direction
+    unsigned long long forwardedBytes(Direction dir) const
+    {
+        return m_forwardedBytes[dir];
+    }
+
+    // Total number of forwarded bytes that weren't decoded because
+    // the decoding couldn't keep up.
+    unsigned long long droppedBytes(Direction dir) const
+    {
+        return m_droppedBytes[dir];
+    }
+
 protected:
     virtual bool socketConnectImpl() override;
     virtual void socketDisconnectImpl() override;
@@ -98,6 +122,7 @@ private slots:
     void connectionSocketConnected();
     void connectionSocketDisconnected();
     void readFromConnectionSocket();
+    void reportPending();
 
 private:
     typedef QTcpSocket* ClientSocketPtr;
@@ -108,7 +133,24 @@ private:
     SocketsList::iterator findByClient(QTcpSocket* socket);
     SocketsList::iterator findByConnection(QTcpSocket* socket);
     void removeConnection(SocketsList::iterator iter);
-    void performReadWrite(QTcpSocket& readFromSocket, QTcpSocket& writeToSocket);
+    void performReadWrite(
+        QTcpSocket& readFromSocket,
+        QTcpSocket& writeToSocket,
+        Direction dir);
+    void assignStreamKey(QTcpSocket& socket);
+
+    struct PendingChunk
+    {
+        DataInfo::DataSeq m_data;
+        DataInfo::Timestamp m_timestamp;
+        DataInfo::StreamKey m_streamKey = 0U;
+        Direction m_dir = Direction_ClientToRemote;
+        QString m_from;
+        QString m_to;
+    };
+
+    typedef std::deque<PendingChunk> PendingChunksList;
+    typedef std::array<unsigned long long, Direction_NumOfValues> BytesCounters;
 
     static const PortType DefaultPort = 20000;
     PortType m_port = DefaultPort;
@@ -117,6 +159,13 @@ private:
 
     QTcpServer m_server;
     SocketsList m_sockets;
+    DataInfo::StreamKey m_nextStreamKey = 1U;
+    PendingChunksList m_pending;
+    std::size_t m_pendingBytes = 0U;
+    bool m_pendingOverflow = false;
+    QTimer m_reportTimer;
+    BytesCounters m_forwardedBytes = BytesCounters();
+    BytesCounters m_droppedBytes = BytesCounters();
 };
 
 }  // namespace proxy
@@ -16,6 +16,8 @@
 // along with this program.  If not, see <http://www.gnu.org/licenses/>.
 
 #include <cassert>
+#include <algorithm>
+#include <vector>
 
 #include "comms/CompileControl.h"
 
@@ -42,6 +44,21 @@ namespace
 
 const QString FromPropName("tcp.from");
 const QString ToPropName("tcp.to");
+const QString QueueMaxPropName("tcp.queue_max");
+const QString QueueTotalPropName("tcp.queue_total");
+
+// Data is kept in the client's queue while socket's own buffer exceeds
+// this limit.
+const qint64 SocketWriteHighWater = 64 * 1024;
+
+// Clients that don't consume data fast enough are disconnected when
+// their queue exceeds this limit.
+const std::size_t MaxClientQueueBytes = 4U * 1024U * 1024U;
+
+QString endpointStr(const QHostAddress& addr, quint16 port)
+{
+    return addr.toString() + ':' + QString("%1").arg(port);
+}
 
 }  // namespace
 
@@ -58,8 +75,13 @@ Socket::Socket()
 
 Socket::~Socket()
 {
-    for (auto* socket : m_sockets) {
-        socket->flush();
+    for (auto& c : m_clients) {
+        assert(c.second);
+        auto& client = *c.second;
+        for (auto& payload : client.m_queue) {
+            client.m_socket->write(payload);
+        }
+        client.m_socket->flush();
     }
 }
 
@@ -80,6 +102,7 @@ bool Socket::socketConnectImpl()
         return false;
     }
 
+    m_fromEndpoint = endpointStr(m_server.serverAddress(), m_server.serverPort());
     return true;
 }
 
@@ -93,27 +116,40 @@ void Socket::sendDataImpl(DataInfoPtr dataPtr)
 {
     assert(dataPtr);
 
-    QVariantList toList;
-
-    for (auto* socketTmp : m_sockets) {
-        auto* socket = qobject_cast<QTcpSocket*>(socketTmp);
-        assert(socket != nullptr);
-        socket->write(
-            reinterpret_cast<const char*>(&dataPtr->m_data[0]),
-            dataPtr->m_data.size());
-
-        QString to =
-            socket->peerAddress().toString() + ':' +
-                        QString("%1").arg(socket->peerPort());
-        toList.append(to);
+    // All the clients' queues share the same payload buffer
+    QByteArray payload(
+        reinterpret_cast<const char*>(dataPtr->m_data.data()),
+        static_cast<int>(dataPtr->m_data.size()));
+    auto payloadSize = static_cast<std::size_t>(payload.size());
+
+    std::vector<Client*> slowClients;
+    std::size_t queueMax = 0U;
+    std::size_t queueTotal = 0U;
+    for (auto& c : m_clients) {
+        assert(c.second);
+        auto& client = *c.second;
+        if (MaxClientQueueBytes < (client.m_queuedBytes + payloadSize)) {
+            slowClients.push_back(&client);
+            continue;
+        }
+
+        client.m_queue.push_back(payload);
+        client.m_queuedBytes += payloadSize;
+        flushClient(client);
+        queueMax = std::max(queueMax, client.m_queuedBytes);
+        queueTotal += client.m_queuedBytes;
     }
 
-    QString from =
-        m_server.serverAddress().toString() + ':' +
-                    QString("%1").arg(m_server.serverPort());
+    dataPtr->m_extraProperties.insert(FromPropName, m_fromEndpoint);
+    dataPtr->m_extraProperties.insert(ToPropName, m_toList);
+    if (queueTotal != 0U) {
+        dataPtr->m_extraProperties.insert(QueueMaxPropName, static_cast<qulonglong>(queueMax));
+        dataPtr->m_extraProperties.insert(QueueTotalPropName, static_cast<qulonglong>(queueTotal));
+    }
 
-    dataPtr->m_extraProperties.insert(FromPropName, from);
-    dataPtr->m_extraProperties.insert(ToPropName, toList);
+    for (auto* client : slowClients) {
+        evictClient(*client);
+    }
 }
 
 unsigned Socket::connectionPropertiesImpl() const
@@ -121,10 +157,33 @@ unsigned Socket::connectionPropertiesImpl() const
     return ConnectionProperty_Autoconnect;
 }
 
+std::size_t Socket::pendingSendBytesImpl() const
+{
+    std::size_t result = 0U;
+    for (auto& c : m_clients) {
+        assert(c.second);
+        auto& client = *c.second;
+        result += client.m_queuedBytes;
+        result += static_cast<std::size_t>(client.m_socket->bytesToWrite());
+    }
+    return result;
+}
+
 void Socket::newConnection()
 {
     auto *newConnSocket = m_server.nextPendingConnection();
-    m_sockets.push_back(newConnSocket);
+
+    ClientPtr client(new Client);
+    client->m_socket = newConnSocket;
+    client->m_endpoint =
+        endpointStr(newConnSocket->peerAddress(), newConnSocket->peerPort());
+
+    // Every connection is a separate stream, decoded independently.
+    client->m_streamKey = m_nextStreamKey;
+    ++m_nextStreamKey;
+    m_clients.insert(std::make_pair(newConnSocket, std::move(client)));
+    refreshEndpoints();
+
     connect(
         newConnSocket, SIGNAL(disconnected()),
         newConnSocket, SLOT(deleteLater()));
@@ -134,6 +193,9 @@ void Socket::newConnection()
     connect(
         newConnSocket, SIGNAL(readyRead()),
         this, SLOT(readFromSocket()));
+    connect(
+        newConnSocket, SIGNAL(bytesWritten(qint64)),
+        this, SLOT(socketBytesWritten(qint64)));
     connect(
         newConnSocket, SIGNAL(error(QAbstractSocket::SocketError)),
         this, SLOT(socketErrorOccurred(QAbstractSocket::SocketError)));
@@ -141,23 +203,29 @@ void Socket::newConnection()
 
 void Socket::connectionTerminated()
 {
-    auto* socket = sender();
-    auto iter = std::find(m_sockets.begin(), m_sockets.end(), socket);
-    if (iter == m_sockets.end()) {
+    auto iter = m_clients.find(sender());
+    if (iter == m_clients.end()) {
         assert(!"Must have found socket");
         return;
     }
 
-    m_sockets.erase(iter);
+    m_clients.erase(iter);
+    refreshEndpoints();
 }
 
 void Socket::readFromSocket()
 {
     auto* socket = qobject_cast<QTcpSocket*>(sender());
     assert(socket != nullptr);
+    auto* client = findClient(socket);
+    if (client == nullptr) {
+        assert(!"Must have found socket");
+        return;
+    }
 
     auto dataPtr = makeDataInfo();
     dataPtr->m_timestamp = DataInfo::TimestampClock::now();
+    dataPtr->m_streamKey = client->m_streamKey;
 
     auto dataSize = socket->bytesAvailable();
     dataPtr->m_data.resize(dataSize);
@@ -167,15 +235,8 @@ void Socket::readFromSocket()
         dataPtr->m_data.resize(result);
     }
 
-    QString from =
-        socket->peerAddress().toString() + ':' +
-                    QString("%1").arg(socket->peerPort());
-    dataPtr->m_extraProperties.insert(FromPropName, from);
-
-    QString to =
-        m_server.serverAddress().toString() + ':' +
-                    QString("%1").arg(m_server.serverPort());
-    dataPtr->m_extraProperties.insert(ToPropName, to);
+    dataPtr->m_extraProperties.insert(FromPropName, client->m_endpoint);
+    dataPtr->m_extraProperties.insert(ToPropName, m_fromEndpoint);
 
     reportDataReceived(std::move(dataPtr));
 }
@@ -203,6 +264,70 @@ void Socket::acceptErrorOccurred(QAbstractSocket::SocketError err)
     }
 }
 
+void Socket::socketBytesWritten(qint64 bytes)
+{
+    static_cast<void>(bytes);
+    auto* client = findClient(sender());
+    if (client != nullptr) {
+        flushClient(*client);
+    }
+}
+
+Socket::Client* Socket::findClient(QObject* socket)
+{
+    auto iter = m_clients.find(socket);
+    if (iter == m_clients.end()) {
+        return nullptr;
+    }
+
+    return iter->second.get();
+}
+
+void Socket::flushClient(Client& client)
+{
+    assert(client.m_socket != nullptr);
+    while ((!client.m_queue.empty()) &&
+           (client.m_socket->bytesToWrite() < SocketWriteHighWater)) {
+        auto& payload = client.m_queue.front();
+        auto written = client.m_socket->write(payload);
+        if (written < 0) {
+            break;
+        }
+
+        auto writtenSize = static_cast<std::size_t>(written);
+        assert(writtenSize <= client.m_queuedBytes);
+        client.m_queuedBytes -= writtenSize;
+        if (written < payload.size()) {
+            payload = payload.mid(static_cast<int>(written));
+            break;
+        }
+
+        client.m_queue.pop_front();
+    }
+}
+
+void Socket::evictClient(Client& client)
+{
+    static const QString EvictedError(
+        tr("Disconnected slow TCP/IP client %1 with %2 bytes pending."));
+    reportError(EvictedError.arg(client.m_endpoint).arg(client.m_queuedBytes));
+
+    client.m_queue.clear();
+    client.m_queuedBytes = 0U;
+
+    // May result in destruction of the client object
+    client.m_socket->abort();
+}
+
+void Socket::refreshEndpoints()
+{
+    m_toList.clear();
+    for (auto& c : m_clients) {
+        assert(c.second);
+        m_toList.append(c.second->m_endpoint);
+    }
+}
+
 }  // namespace server
 
 }  // namespace tcp_socket
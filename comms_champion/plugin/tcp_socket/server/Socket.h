@@ -17,13 +17,17 @@
 
 #pragma once
 
-#include <list>
+#include <map>
+#include <deque>
+#include <memory>
 
 #include "comms/CompileControl.h"
 
 CC_DISABLE_WARNINGS()
 #include <QtNetwork/QTcpServer>
 #include <QtNetwork/QTcpSocket>
+#include <QtCore/QByteArray>
+#include <QtCore/QVariantList>
 CC_ENABLE_WARNINGS()
 
 #include "comms_champion/Socket.h"
@@ -68,6 +72,7 @@ protected:
     virtual void socketDisconnectImpl() override;
     virtual void sendDataImpl(DataInfoPtr dataPtr) override;
     virtual unsigned connectionPropertiesImpl() const override;
+    virtual std::size_t pendingSendBytesImpl() const override;
 
 private slots:
     void newConnection();
@@ -75,11 +80,32 @@ private slots:
     void readFromSocket();
     void socketErrorOccurred(QAbstractSocket::SocketError err);
     void acceptErrorOccurred(QAbstractSocket::SocketError err);
+    void socketBytesWritten(qint64 bytes);
 
 private:
+    struct Client
+    {
+        QTcpSocket* m_socket = nullptr;
+        QString m_endpoint;
+        DataInfo::StreamKey m_streamKey = 0U;
+        std::deque<QByteArray> m_queue;
+        std::size_t m_queuedBytes = 0U;
+    };
+
+    typedef std::unique_ptr<Client> ClientPtr;
+    typedef std::map<QObject*, ClientPtr> ClientsMap;
+
+    Client* findClient(QObject* socket);
+    void flushClient(Client& client);
+    void evictClient(Client& client);
+    void refreshEndpoints();
+
     static const PortType DefaultPort = 20000;
     PortType m_port = DefaultPort;
-    std::list<QTcpSocket*> m_sockets;
+    DataInfo::StreamKey m_nextStreamKey = 1U;
+    ClientsMap m_clients;
+    QVariantList m_toList;
+    QString m_fromEndpoint;
     QTcpServer m_server;
 };
 
@@ -42,6 +42,7 @@ const QString HostSubKey("host");
 const QString PortSubKey("port");
 const QString LocalPortSubKey("local_port");
 const QString BroadcastPropName("broadcast_prop");
+const QString RecvBatchSubKey("recv_batch");
 
 }  // namespace
 
@@ -74,6 +75,7 @@ void Plugin::getCurrentConfigImpl(QVariantMap& config)
     subConfig.insert(PortSubKey, m_socket->getPort());
     subConfig.insert(LocalPortSubKey, m_socket->getLocalPort());
     subConfig.insert(BroadcastPropName, m_socket->getBroadcastPropName());
+    subConfig.insert(RecvBatchSubKey, m_socket->getRecvBatchSize());
     config.insert(MainConfigKey, QVariant::fromValue(subConfig));
 }
 
@@ -113,6 +115,14 @@ void Plugin::reconfigureImpl(const QVariantMap& config)
         auto propName = broadcastBroadcastNameVar.value<QString>();
         m_socket->setBroadcastPropName(propName);
     }
+
+    auto recvBatchVar = subConfig.value(RecvBatchSubKey);
+    if (recvBatchVar.isValid() && recvBatchVar.canConvert<unsigned>()) {
+        auto batchSize = recvBatchVar.value<unsigned>();
+        if ((0U < batchSize) && (batchSize <= Socket::MaxRecvBatchSize)) {
+            m_socket->setRecvBatchSize(batchSize);
+        }
+    }
 }
 
 void Plugin::createSocketIfNeeded()
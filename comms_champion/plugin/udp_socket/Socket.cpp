@@ -16,14 +16,22 @@
 // along with this program.  If not, see <http://www.gnu.org/licenses/>.
 
 #include <cassert>
+#include <cstring>
+#include <algorithm>
 #include <iostream>
 
 #include "comms/CompileControl.h"
 
 CC_DISABLE_WARNINGS()
+#include <QtCore/QtGlobal>
 #include <QtNetwork/QHostAddress>
 CC_ENABLE_WARNINGS()
 
+#ifdef Q_OS_LINUX
+#include <sys/socket.h>
+#include <netinet/in.h>
+#endif
+
 #include "Socket.h"
 
 namespace comms_champion
@@ -46,8 +54,18 @@ const QString DefaultBroadcastPropName("broadcast");
 const QString FromPropName("udp.from");
 const QString ToPropName("udp.to");
 
+// Every natively received datagram gets a slot of this size in the slab
+const std::size_t MaxDatagramSize = 64U * 1024U;
+
+QString endpointStr(const QHostAddress& addr, quint16 port)
+{
+    return addr.toString() + ':' + QString("%1").arg(port);
+}
+
 }  // namespace
 
+const unsigned Socket::MaxRecvBatchSize;
+
 
 Socket::Socket()
   : m_host(DefaultHost),
@@ -94,6 +112,8 @@ bool Socket::socketConnectImpl()
     assert(!m_socket.isOpen());
     assert(!m_broadcastSocket.isOpen());
     m_running = true;
+    m_peerAddress.clear();
+    m_peerPort = 0U;
 
     do {
         if (m_localPort == 0) {
@@ -120,6 +140,8 @@ bool Socket::socketConnectImpl()
             reportError("Failed to connect UDP socket to " + QString("%1:%2").arg(m_host).arg(m_port));
         }
     } while (false);
+
+    m_localEndpoint = endpointStr(m_socket.localAddress(), m_socket.localPort());
     return true;
 }
 
@@ -135,10 +157,7 @@ void Socket::socketDisconnectImpl()
 void Socket::sendDataImpl(DataInfoPtr dataPtr)
 {
     assert(dataPtr);
-    QString from =
-        m_socket.localAddress().toString() + ':' +
-                    QString("%1").arg(m_socket.localPort());
-    dataPtr->m_extraProperties.insert(FromPropName, from);
+    dataPtr->m_extraProperties.insert(FromPropName, m_localEndpoint);
 
     do {
         if ((!dataPtr->m_extraProperties.contains(m_broadcastPropName)) ||
@@ -176,6 +195,22 @@ void Socket::sendDataImpl(DataInfoPtr dataPtr)
         return;
     }
 
+    if ((m_socket.state() != QUdpSocket::ConnectedState) && (m_peerPort != 0U)) {
+        // Reply to the first peer the data was received from
+        auto count =
+            m_socket.writeDatagram(
+                reinterpret_cast<const char*>(dataPtr->m_data.data()),
+                dataPtr->m_data.size(),
+                m_peerAddress,
+                m_peerPort);
+        if (count < 0) {
+            return;
+        }
+
+        dataPtr->m_extraProperties.insert(ToPropName, endpointStr(m_peerAddress, m_peerPort));
+        return;
+    }
+
     std::size_t writtenCount = 0;
     while (writtenCount < dataPtr->m_data.size()) {
         auto remSize = dataPtr->m_data.size() - writtenCount;
@@ -221,37 +256,174 @@ void Socket::socketErrorOccurred(QAbstractSocket::SocketError err)
 
 void Socket::readData(QUdpSocket& socket)
 {
-    while (socket.hasPendingDatagrams()) {
-        QHostAddress senderAddress;
-        quint16 senderPort;
+    auto batchSize =
+        static_cast<std::size_t>(
+            std::min(std::max(m_recvBatchSize, 1U), MaxRecvBatchSize));
+
+    bool firstBatch = true;
+    while (m_running && socket.isOpen()) {
+        m_batch.clear();
+        if (firstBatch) {
+            // Reading via QUdpSocket re-enables its read notifications,
+            // the rest may be received directly from the descriptor.
+            receiveDatagrams(socket, 1U);
+            firstBatch = false;
+        }
+
+        receiveDatagramsNative(socket, batchSize);
+        auto count = m_batch.size();
+        if (count == 0U) {
+            break;
+        }
+
+        reportBatch();
+        if (count < batchSize) {
+            break;
+        }
+    }
+}
+
+void Socket::receiveDatagrams(QUdpSocket& socket, std::size_t limit)
+{
+    while ((m_batch.size() < limit) && socket.hasPendingDatagrams()) {
+        auto size = socket.pendingDatagramSize();
+        if (size < 0) {
+            break;
+        }
+
+        Datagram datagram;
+        datagram.m_offset = batchEnd();
+        auto required = datagram.m_offset + static_cast<std::size_t>(size);
+        if (m_slab.size() < required) {
+            m_slab.resize(required);
+        }
+
+        auto result =
+            socket.readDatagram(
+                reinterpret_cast<char*>(m_slab.data() + datagram.m_offset),
+                size,
+                &datagram.m_address,
+                &datagram.m_port);
+        if (result < 0) {
+            break;
+        }
+
+        datagram.m_size = static_cast<std::size_t>(result);
+        m_batch.push_back(std::move(datagram));
+    }
+}
+
+void Socket::receiveDatagramsNative(QUdpSocket& socket, std::size_t limit)
+{
+#ifdef Q_OS_LINUX
+    auto fd = socket.socketDescriptor();
+    if ((fd < 0) || (limit <= m_batch.size())) {
+        return;
+    }
+
+    auto count = std::min(limit - m_batch.size(), static_cast<std::size_t>(MaxRecvBatchSize));
+    if (count <= 1U) {
+        receiveDatagrams(socket, limit);
+        return;
+    }
+
+    auto offset = batchEnd();
+    auto required = offset + (count * MaxDatagramSize);
+    if (m_slab.size() < required) {
+        m_slab.resize(required);
+    }
+
+    mmsghdr headers[MaxRecvBatchSize];
+    iovec buffers[MaxRecvBatchSize];
+    sockaddr_storage addresses[MaxRecvBatchSize];
+    std::memset(headers, 0, sizeof(headers));
+    for (std::size_t idx = 0U; idx < count; ++idx) {
+        buffers[idx].iov_base = m_slab.data() + offset + (idx * MaxDatagramSize);
+        buffers[idx].iov_len = MaxDatagramSize;
+        headers[idx].msg_hdr.msg_name = &addresses[idx];
+        headers[idx].msg_hdr.msg_namelen = sizeof(addresses[idx]);
+        headers[idx].msg_hdr.msg_iov = &buffers[idx];
+        headers[idx].msg_hdr.msg_iovlen = 1;
+    }
 
+    auto result =
+        ::recvmmsg(
+            static_cast<int>(fd),
+            headers,
+            static_cast<unsigned>(count),
+            MSG_DONTWAIT,
+            nullptr);
+
+    for (int idx = 0; idx < result; ++idx) {
+        auto* addr = reinterpret_cast<const sockaddr*>(&addresses[idx]);
+        Datagram datagram;
+        datagram.m_offset = offset + (static_cast<std::size_t>(idx) * MaxDatagramSize);
+        datagram.m_size = headers[idx].msg_len;
+        datagram.m_address.setAddress(addr);
+        if (addr->sa_family == AF_INET) {
+            datagram.m_port = ntohs(reinterpret_cast<const sockaddr_in*>(addr)->sin_port);
+        }
+        else if (addr->sa_family == AF_INET6) {
+            datagram.m_port = ntohs(reinterpret_cast<const sockaddr_in6*>(addr)->sin6_port);
+        }
+        m_batch.push_back(std::move(datagram));
+    }
+#else
+    receiveDatagrams(socket, limit);
+#endif
+}
+
+std::size_t Socket::batchEnd() const
+{
+    if (m_batch.empty()) {
+        return 0U;
+    }
+
+    return m_batch.back().m_offset + m_batch.back().m_size;
+}
+
+void Socket::reportBatch()
+{
+    // Datagram boundaries may be frame boundaries, every datagram is
+    // reported separately, all with the timestamp of the batch.
+    auto timestamp = DataInfo::TimestampClock::now();
+    for (auto& datagram : m_batch) {
         auto dataPtr = makeDataInfo();
-        dataPtr->m_timestamp = DataInfo::TimestampClock::now();
-        dataPtr->m_data.resize(socket.pendingDatagramSize());
-        socket.readDatagram(
-            reinterpret_cast<char*>(&dataPtr->m_data[0]),
-            dataPtr->m_data.size(),
-            &senderAddress,
-            &senderPort);
-
-        QString from =
-            senderAddress.toString() + ':' +
-                        QString("%1").arg(senderPort);
-        QString to =
-            m_socket.localAddress().toString() + ':' +
-                        QString("%1").arg(m_socket.localPort());
+        dataPtr->m_timestamp = timestamp;
 
-        dataPtr->m_extraProperties.insert(FromPropName, from);
-        dataPtr->m_extraProperties.insert(ToPropName, to);
-        reportDataReceived(std::move(dataPtr));
+        // Datagrams from every peer are reassembled independently
+        dataPtr->m_streamKey =
+            (static_cast<DataInfo::StreamKey>(qHash(datagram.m_address)) << 16) |
+            datagram.m_port;
+
+        auto* begin = m_slab.data() + datagram.m_offset;
+        dataPtr->m_data.assign(begin, begin + datagram.m_size);
 
-        if (m_socket.state() != QUdpSocket::ConnectedState) {
-            m_socket.connectToHost(senderAddress, senderPort);
-            m_socket.waitForConnected();
-            assert(m_socket.isOpen());
-            assert(m_socket.state() == QUdpSocket::ConnectedState);
+        dataPtr->m_extraProperties.insert(
+            FromPropName, peerEndpoint(datagram.m_address, datagram.m_port));
+        dataPtr->m_extraProperties.insert(ToPropName, m_localEndpoint);
+
+        if ((m_peerPort == 0U) &&
+            (m_socket.state() != QUdpSocket::ConnectedState)) {
+            m_peerAddress = datagram.m_address;
+            m_peerPort = datagram.m_port;
         }
+
+        reportDataReceived(std::move(dataPtr));
+    }
+}
+
+const QString& Socket::peerEndpoint(const QHostAddress& address, quint16 port)
+{
+    if ((port != m_lastSenderPort) ||
+        (address != m_lastSenderAddress) ||
+        m_lastSenderEndpoint.isEmpty()) {
+        m_lastSenderAddress = address;
+        m_lastSenderPort = port;
+        m_lastSenderEndpoint = endpointStr(address, port);
     }
+
+    return m_lastSenderEndpoint;
 }
 
 bool Socket::bindSocket(QUdpSocket& socket)
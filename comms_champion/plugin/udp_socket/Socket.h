@@ -17,12 +17,14 @@
 
 #pragma once
 
-#include <list>
+#include <vector>
+#include <cstdint>
 
 #include "comms/CompileControl.h"
 
 CC_DISABLE_WARNINGS()
 #include <QtNetwork/QUdpSocket>
+#include <QtNetwork/QHostAddress>
 CC_ENABLE_WARNINGS()
 
 #include "comms_champion/Socket.h"
@@ -92,6 +94,21 @@ public:
         return m_broadcastPropName;
     }
 
+    // Maximal number of datagrams received in one go. Consecutive
+    // datagrams of the same batch coming from the same peer are
+    // reported as a single data chunk.
+    void setRecvBatchSize(unsigned value)
+    {
+        m_recvBatchSize = value;
+    }
+
+    unsigned getRecvBatchSize() const
+    {
+        return m_recvBatchSize;
+    }
+
+    static const unsigned MaxRecvBatchSize = 64U;
+
 protected:
     virtual bool socketConnectImpl() override;
     virtual void socketDisconnectImpl() override;
@@ -104,7 +121,22 @@ private slots:
     void socketErrorOccurred(QAbstractSocket::SocketError err);
 
 private:
+    struct Datagram
+    {
+        std::size_t m_offset = 0U;
+        std::size_t m_size = 0U;
+        QHostAddress m_address;
+        quint16 m_port = 0U;
+    };
+
+    typedef std::vector<Datagram> DatagramsList;
+
     void readData(QUdpSocket& socket);
+    void receiveDatagrams(QUdpSocket& socket, std::size_t limit);
+    void receiveDatagramsNative(QUdpSocket& socket, std::size_t limit);
+    std::size_t batchEnd() const;
+    void reportBatch();
+    const QString& peerEndpoint(const QHostAddress& address, quint16 port);
     bool bindSocket(QUdpSocket& socket);
 
     static const PortType DefaultPort = 20000;
@@ -113,8 +145,17 @@ private:
     PortType m_port = DefaultPort;
     PortType m_localPort = 0;
     QString m_broadcastPropName;
+    unsigned m_recvBatchSize = 1U;
     QUdpSocket m_socket;
     QUdpSocket m_broadcastSocket;
+    std::vector<std::uint8_t> m_slab;
+    DatagramsList m_batch;
+    QString m_localEndpoint;
+    QHostAddress m_lastSenderAddress;
+    quint16 m_lastSenderPort = 0U;
+    QString m_lastSenderEndpoint;
+    QHostAddress m_peerAddress;
+    quint16 m_peerPort = 0U;
     bool m_running = false;
 };
 
@@ -57,6 +57,13 @@ SocketConfigWidget::SocketConfigWidget(
 
     m_ui.m_broadcastLineEdit->setText(m_socket.getBroadcastPropName());
 
+    m_ui.m_recvBatchSpinBox->setRange(
+        1,
+        static_cast<int>(Socket::MaxRecvBatchSize));
+
+    m_ui.m_recvBatchSpinBox->setValue(
+        static_cast<int>(m_socket.getRecvBatchSize()));
+
     connect(
         m_ui.m_hostLineEdit, SIGNAL(textChanged(const QString&)),
         this, SLOT(hostValueChanged(const QString&)));
@@ -73,6 +80,10 @@ SocketConfigWidget::SocketConfigWidget(
         m_ui.m_broadcastLineEdit, SIGNAL(textChanged(const QString&)),
         this, SLOT(broadcastValueChanged(const QString&)));
 
+    connect(
+        m_ui.m_recvBatchSpinBox, SIGNAL(valueChanged(int)),
+        this, SLOT(recvBatchValueChanged(int)));
+
 }
 
 SocketConfigWidget::~SocketConfigWidget() = default;
@@ -97,6 +108,11 @@ void SocketConfigWidget::broadcastValueChanged(const QString& value)
     m_socket.setBroadcastPropName(value);
 }
 
+void SocketConfigWidget::recvBatchValueChanged(int value)
+{
+    m_socket.setRecvBatchSize(static_cast<unsigned>(value));
+}
+
 }  // namespace client
 
 }  // namespace udp_socket
@@ -57,6 +57,7 @@ private slots:
     void portValueChanged(int value);
     void localPortValueChanged(int value);
     void broadcastValueChanged(const QString& value);
+    void recvBatchValueChanged(int value);
 
 private:
     Socket& m_socket;